@@ -719,6 +719,7 @@ class CLI
         #gem_install: [ Proc.new { ::InstallGem }, {primary: false, working: false}], # DLM: needs Ruby built with FFI
         measure: [ Proc.new { ::Measure }, {primary: true, working: false}],
         update: [ Proc.new { ::Update }, {primary: true, working: false}],
+        forward_translate: [ Proc.new { ::ForwardTranslate }, {primary: false, working: true}],
         execute_ruby_script: [ Proc.new { ::ExecuteRubyScript }, {primary: false, working: true}],
         #interactive_ruby: [ Proc.new { ::InteractiveRubyShell }, {primary: false, working: false}], # DLM: not working
         openstudio_version: [ Proc.new { ::OpenStudioVersion }, {primary: true, working: true}],
@@ -1504,6 +1505,81 @@ class Update
   end
 end
 
+# Class to translate an OpenStudio Model to EnergyPlus
+class ForwardTranslate
+
+  # Provides text for the main help functionality
+  def self.synopsis
+    'Translates an OpenStudio Model to an EnergyPlus IDF'
+  end
+
+  # Executes code to translate the model and optionally write the translation profile
+  #
+  # @param [Array] sub_argv Options passed to the forward_translate command from the user input
+  # @return [Fixnum] Return status
+  #
+  def execute(sub_argv)
+
+    $logger.info "ForwardTranslate, sub_argv = #{sub_argv}"
+
+    options = {}
+    options[:output] = nil
+    options[:profile] = nil
+
+    opts = OptionParser.new do |o|
+      o.banner = 'Usage: openstudio forward_translate [options] PATH'
+      o.separator ''
+      o.separator 'Options:'
+      o.separator ''
+
+      o.on('-o', '--output IDF', 'Path of the IDF to write, defaults to PATH with an .idf extension') do |output|
+        options[:output] = output
+      end
+      o.on('-p', '--profile JSON', 'Write the per object type timing and object count profile of the translation to JSON') do |profile|
+        options[:profile] = profile
+      end
+    end
+
+    # Parse the options
+    argv = parse_options(opts, sub_argv)
+    return 0 if argv == nil
+
+    $logger.debug("ForwardTranslate command: #{argv.inspect} #{options.inspect}")
+
+    if argv == []
+      $logger.error 'No path provided'
+      return 1
+    end
+    path = File.expand_path(argv[0])
+
+    vt = OpenStudio::OSVersion::VersionTranslator.new
+    model = vt.loadModel(path)
+    if model.empty?
+      $logger.error("Could not read model at #{path}")
+      return 1
+    end
+
+    ft = OpenStudio::EnergyPlus::ForwardTranslator.new
+    ft.setProfileTranslation(true) if options[:profile]
+    workspace = ft.translateModel(model.get)
+
+    ft.errors.each { |error| $logger.error(error.logMessage) }
+    ft.warnings.each { |warning| $logger.warn(warning.logMessage) }
+
+    output = options[:output] ? File.expand_path(options[:output]) : path.sub(/\.osm$/i, '') + '.idf'
+    workspace.save(output, true)
+    $logger.info("Wrote #{output}")
+
+    if options[:profile]
+      profile = File.expand_path(options[:profile])
+      File.open(profile, 'w') { |f| f << ft.translationProfile.toJSON }
+      $logger.info("Wrote #{profile}")
+    end
+
+    0
+  end
+end
+
 # Class to execute a ruby script
 class ExecuteRubyScript
 
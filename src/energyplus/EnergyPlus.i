@@ -48,6 +48,10 @@
 
 %include <energyplus/ErrorFile.hpp>
 %include <energyplus/ForwardTranslator.hpp>
+
+%template(ForwardTranslatorProfileStepVector) std::vector<openstudio::energyplus::ForwardTranslatorProfileStep>;
+%template(ForwardTranslatorProfileEntryVector) std::vector<openstudio::energyplus::ForwardTranslatorProfileEntry>;
+
 %include <energyplus/ReverseTranslator.hpp>
 
 #endif //ENERGYPLUS_I
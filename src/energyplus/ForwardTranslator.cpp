@@ -58,6 +58,10 @@
 #include "../model/ShadingControl_Impl.hpp"
 #include "../model/AdditionalProperties.hpp"
 #include "../model/ConcreteModelObjects.hpp"
+#include "../model/Curve.hpp"
+#include "../model/Curve_Impl.hpp"
+#include "../model/Material.hpp"
+#include "../model/Material_Impl.hpp"
 
 #include "../utilities/idf/Workspace.hpp"
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
@@ -84,7 +88,13 @@
 
 #include "../utilities/idd/IddEnums.hpp"
 
+#include <json/json.h>
+
+#include <algorithm>
 #include <thread>
+#include <future>
+#include <memory>
+#include <set>
 
 #include <sstream>
 
@@ -108,10 +118,15 @@ namespace energyplus {
     m_excludeSQliteOutputReport = false;
     m_excludeHTMLOutputReport = false;
     m_excludeVariableDictionary = false;
+    m_keepWorkspaceObjects = false;
+    m_parallelTranslation = false;
+    m_profileTranslation = false;
   }
 
   Workspace ForwardTranslator::translateModel(const Model& model, ProgressBar* progressBar) {
+    const std::chrono::steady_clock::time_point cloneStart = std::chrono::steady_clock::now();
     Model modelCopy = model.clone(true).cast<Model>();
+    const std::chrono::steady_clock::time_point cloneEnd = std::chrono::steady_clock::now();
 
     m_progressBar = progressBar;
     if (m_progressBar) {
@@ -119,16 +134,24 @@ namespace energyplus {
       m_progressBar->setMaximum(model.numObjects());
     }
 
-    return translateModelPrivate(modelCopy, true);
+    Workspace workspace = translateModelPrivate(modelCopy, true);
+    prependProfileStep("Clone model", cloneStart, cloneEnd);
+
+    return workspace;
   }
 
   Workspace ForwardTranslator::translateModelObject(ModelObject& modelObject) {
+    const std::chrono::steady_clock::time_point cloneStart = std::chrono::steady_clock::now();
     Model modelCopy;
     modelObject.clone(modelCopy);
+    const std::chrono::steady_clock::time_point cloneEnd = std::chrono::steady_clock::now();
 
     m_progressBar = nullptr;
 
-    return translateModelPrivate(modelCopy, false);
+    Workspace workspace = translateModelPrivate(modelCopy, false);
+    prependProfileStep("Clone model", cloneStart, cloneEnd);
+
+    return workspace;
   }
 
   std::vector<LogMessage> ForwardTranslator::warnings() const {
@@ -140,6 +163,18 @@ namespace energyplus {
       }
     }
 
+    for (const LogMessage& logMessage : m_parallelLogMessages) {
+      if (logMessage.logLevel() == Warn) {
+        result.push_back(logMessage);
+      }
+    }
+
+    for (const LogMessage& logMessage : m_retainedLogMessages) {
+      if (logMessage.logLevel() == Warn) {
+        result.push_back(logMessage);
+      }
+    }
+
     return result;
   }
 
@@ -152,6 +187,18 @@ namespace energyplus {
       }
     }
 
+    for (const LogMessage& logMessage : m_parallelLogMessages) {
+      if (logMessage.logLevel() > Warn) {
+        result.push_back(logMessage);
+      }
+    }
+
+    for (const LogMessage& logMessage : m_retainedLogMessages) {
+      if (logMessage.logLevel() > Warn) {
+        result.push_back(logMessage);
+      }
+    }
+
     return result;
   }
 
@@ -179,9 +226,88 @@ namespace energyplus {
     m_excludeVariableDictionary = excludeVariableDictionary;
   }
 
+  void ForwardTranslator::setParallelTranslation(bool parallelTranslation) {
+    m_parallelTranslation = parallelTranslation;
+  }
+
+  void ForwardTranslator::setProfileTranslation(bool profileTranslation) {
+    m_profileTranslation = profileTranslation;
+  }
+
+  ForwardTranslatorProfile ForwardTranslator::translationProfile() const {
+    ForwardTranslatorProfile result = m_profile;
+    for (const auto& profileEntry : m_profileEntries) {
+      result.entries.push_back(profileEntry.second);
+    }
+    std::stable_sort(result.entries.begin(), result.entries.end(),
+                     [](const ForwardTranslatorProfileEntry& a, const ForwardTranslatorProfileEntry& b) { return a.exclusiveTime > b.exclusiveTime; });
+    return result;
+  }
+
+  void ForwardTranslator::recordProfileStep(const std::string& name, std::chrono::steady_clock::time_point& start) {
+    if (!m_profileTranslation) {
+      return;
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    ForwardTranslatorProfileStep step;
+    step.name = name;
+    step.time = std::chrono::duration<double>(end - start).count();
+    m_profile.steps.push_back(step);
+    start = end;
+  }
+
+  void ForwardTranslator::prependProfileStep(const std::string& name, const std::chrono::steady_clock::time_point& start,
+                                             const std::chrono::steady_clock::time_point& end) {
+    if (!m_profileTranslation) {
+      return;
+    }
+    ForwardTranslatorProfileStep step;
+    step.name = name;
+    step.time = std::chrono::duration<double>(end - start).count();
+    m_profile.steps.insert(m_profile.steps.begin(), step);
+    m_profile.totalTime += step.time;
+  }
+
+  std::string ForwardTranslatorProfile::toJSON() const {
+    Json::Value root;
+    root["total_time"] = totalTime;
+
+    Json::Value stepsValue(Json::arrayValue);
+    for (const ForwardTranslatorProfileStep& step : steps) {
+      Json::Value stepValue;
+      stepValue["name"] = step.name;
+      stepValue["time"] = step.time;
+      stepsValue.append(stepValue);
+    }
+    root["steps"] = stepsValue;
+
+    Json::Value entriesValue(Json::arrayValue);
+    for (const ForwardTranslatorProfileEntry& entry : entries) {
+      Json::Value entryValue;
+      entryValue["idd_object_type"] = entry.iddObjectType.valueDescription();
+      entryValue["calls"] = entry.calls;
+      entryValue["inclusive_time"] = entry.inclusiveTime;
+      entryValue["exclusive_time"] = entry.exclusiveTime;
+      entryValue["idf_objects"] = entry.idfObjects;
+      entriesValue.append(entryValue);
+    }
+    root["entries"] = entriesValue;
+
+    Json::StreamWriterBuilder wbuilder;
+    // mimic the old StyledWriter behavior:
+    wbuilder["indentation"] = "   ";
+    return Json::writeString(wbuilder, root);
+  }
+
   Workspace ForwardTranslator::translateModelPrivate(model::Model& model, bool fullModelTranslation) {
     reset();
 
+    // every translation starts a new profile, including the ones run by a ForwardTranslatorSession
+    m_profile = ForwardTranslatorProfile();
+    m_profileEntries.clear();
+    const std::chrono::steady_clock::time_point translationStart = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point stepStart = translationStart;
+
     // translate Version first
     model::Version version = model.getUniqueModelObject<model::Version>();
     translateAndMapModelObject(version);
@@ -189,11 +315,13 @@ namespace energyplus {
     // translate Timestep second (this initializes it if need be)
     model::Timestep timestep = model.getUniqueModelObject<model::Timestep>();
     translateAndMapModelObject(timestep);
+    recordProfileStep("Translate version and timestep", stepStart);
 
     // resolve surface marching conflicts before combining thermal zones or removing spaces
     // as those operations may change search distances
     resolveMatchedSurfaceConstructionConflicts(model);
     resolveMatchedSubSurfaceConstructionConflicts(model);
+    recordProfileStep("Resolve matched surface construction conflicts", stepStart);
 
     // remove subsurfaces from air walls
     for (Surface surface : model.getConcreteModelObjects<Surface>()) {
@@ -235,6 +363,7 @@ namespace energyplus {
       LOG(Warn, "Removing AirWallMaterial '" << airWall.nameString() << "'.");
       airWall.remove();
     }
+    recordProfileStep("Replace air walls", stepStart);
 
     // check for spaces not in a thermal zone
     for (Space space : model.getConcreteModelObjects<Space>()) {
@@ -266,12 +395,14 @@ namespace energyplus {
         spaceLoad.remove();
       }
     }
+    recordProfileStep("Remove orphan spaces, surfaces and loads", stepStart);
 
     // next thing to do is combine all spaces in each thermal zone
     // after this each zone will have 0 or 1 spaces and each space will have 0 or 1 zone
     for (ThermalZone thermalZone : model.getConcreteModelObjects<ThermalZone>()) {
       thermalZone.combineSpaces();
     }
+    recordProfileStep("Combine spaces", stepStart);
 
     // remove unused space types
     std::vector<SpaceType> spaceTypes = model.getConcreteModelObjects<SpaceType>();
@@ -329,6 +460,7 @@ namespace energyplus {
         iTequipment.remove();
       }
     }
+    recordProfileStep("Apply space type loads", stepStart);
 
     // Temporary workaround for EnergyPlusTeam #4451
     // requested by http://code.google.com/p/cbecc/issues/detail?id=736
@@ -416,6 +548,7 @@ namespace energyplus {
         holiday.remove();
       }
     }
+    recordProfileStep("Prepare daylighting and shading controls", stepStart);
 
     if (fullModelTranslation) {
 
@@ -540,6 +673,10 @@ namespace energyplus {
       std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
       std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
 
+      if (m_parallelTranslation && translateIndependentObjectsInParallel(objects)) {
+        continue;
+      }
+
       for (const WorkspaceObject& workspaceObject : objects) {
         model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
         translateAndMapModelObject(modelObject);
@@ -550,6 +687,7 @@ namespace energyplus {
       // add output requests
       this->createStandardOutputRequests();
     }
+    recordProfileStep("Translate objects", stepStart);
 
     Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
     OptionalWorkspaceObject vo = workspace.versionObject();
@@ -557,9 +695,16 @@ namespace energyplus {
     workspace.removeObject(vo->handle());
 
     workspace.setFastNaming(true);
-    workspace.addObjects(m_idfObjects);
+    std::vector<WorkspaceObject> workspaceObjects = workspace.addObjects(m_idfObjects);
     workspace.setFastNaming(false);
+    if (m_keepWorkspaceObjects) {
+      m_workspaceObjects = workspaceObjects;
+    }
     OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
+    recordProfileStep("Add objects to workspace", stepStart);
+    if (m_profileTranslation) {
+      m_profile.totalTime = std::chrono::duration<double>(stepStart - translationStart).count();
+    }
 
     return workspace;
   }
@@ -597,14 +742,180 @@ namespace energyplus {
   };
 
   boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelObject& modelObject) {
-    boost::optional<IdfObject> retVal;
-
     // if already translated then exit
     ModelObjectMap::const_iterator objInMap = m_map.find(modelObject.handle());
     if (objInMap != m_map.end()) {
       return boost::optional<IdfObject>(objInMap->second);
     }
 
+    const std::size_t firstIdfObject = m_idfObjects.size();
+
+    std::chrono::steady_clock::time_point start;
+    if (m_profileTranslation) {
+      start = std::chrono::steady_clock::now();
+      m_profileNestedTimes.push_back(0.0);
+    }
+
+    boost::optional<IdfObject> retVal = translateAndMapModelObjectByType(modelObject);
+
+    // nested translations have already claimed their objects, the rest belong to this one
+    unsigned numOwned = 0;
+    m_idfObjectOwners.resize(m_idfObjects.size());
+    for (std::size_t i = firstIdfObject, n = m_idfObjects.size(); i < n; ++i) {
+      if (m_idfObjectOwners[i].isNull()) {
+        m_idfObjectOwners[i] = modelObject.handle();
+        ++numOwned;
+      }
+    }
+
+    if (m_profileTranslation) {
+      const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      const double nestedTime = m_profileNestedTimes.back();
+      m_profileNestedTimes.pop_back();
+      if (!m_profileNestedTimes.empty()) {
+        m_profileNestedTimes.back() += time;
+      }
+
+      const IddObjectType iddObjectType = modelObject.iddObjectType();
+      ForwardTranslatorProfileEntry& entry = m_profileEntries[iddObjectType.value()];
+      entry.iddObjectType = iddObjectType;
+      ++entry.calls;
+      entry.inclusiveTime += time;
+      entry.exclusiveTime += time - nestedTime;
+      entry.idfObjects += numOwned;
+    }
+
+    return retVal;
+  }
+
+  std::vector<IdfObject> ForwardTranslator::translateOwnedIdfObjects(model::ModelObject& modelObject) {
+    // reset drops the log messages, keep the ones of the translation being patched
+    std::vector<LogMessage> logMessages = m_retainedLogMessages;
+    for (const LogMessage& logMessage : m_logSink.logMessages()) {
+      logMessages.push_back(logMessage);
+    }
+    logMessages.insert(logMessages.end(), m_parallelLogMessages.begin(), m_parallelLogMessages.end());
+
+    reset();
+
+    translateAndMapModelObject(modelObject);
+
+    // objects are translated more than once per patch, only add the messages not seen yet
+    for (const LogMessage& logMessage : m_logSink.logMessages()) {
+      if (std::none_of(logMessages.begin(), logMessages.end(), [&logMessage](const LogMessage& other) {
+            return (other.logLevel() == logMessage.logLevel()) && (other.logMessage() == logMessage.logMessage());
+          })) {
+        logMessages.push_back(logMessage);
+      }
+    }
+    m_logSink.resetStringStream();
+    m_retainedLogMessages = logMessages;
+
+    std::vector<IdfObject> result;
+    for (std::size_t i = 0, n = m_idfObjects.size(); i < n; ++i) {
+      if (m_idfObjectOwners[i] == modelObject.handle()) {
+        result.push_back(m_idfObjects[i]);
+      }
+    }
+    return result;
+  }
+
+  bool ForwardTranslator::translateIndependentObjectsInParallel(const std::vector<WorkspaceObject>& objects) {
+    // only curves and materials are translated from their own fields alone, other objects share helper objects or translate
+    // the objects they point to, and would end up duplicated across translators
+    std::vector<ModelObject> toTranslate;
+    for (const WorkspaceObject& workspaceObject : objects) {
+      if (m_map.find(workspaceObject.handle()) == m_map.end()) {
+        ModelObject modelObject = workspaceObject.cast<ModelObject>();
+        if (!modelObject.optionalCast<Curve>() && !modelObject.optionalCast<Material>()) {
+          return false;
+        }
+        toTranslate.push_back(modelObject);
+      }
+    }
+
+    // not worth starting threads for a handful of objects
+    const std::size_t minObjectsPerThread = 64;
+    const std::size_t numThreads =
+      std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), toTranslate.size() / minObjectsPerThread);
+    if (numThreads < 2) {
+      return false;
+    }
+
+    // each worker translates a contiguous chunk, merging the chunks in order gives the same result as the serial loop
+    const std::size_t chunkSize = (toTranslate.size() + numThreads - 1) / numThreads;
+    std::vector<std::unique_ptr<ForwardTranslator>> workers;
+    std::vector<std::future<bool>> results;
+    for (std::size_t begin = 0; begin < toTranslate.size(); begin += chunkSize) {
+      const std::size_t end = std::min(begin + chunkSize, toTranslate.size());
+      workers.push_back(std::make_unique<ForwardTranslator>());
+      ForwardTranslator* worker = workers.back().get();
+      worker->m_profileTranslation = m_profileTranslation;
+      results.push_back(
+        std::async(std::launch::async, [worker, &toTranslate, begin, end]() { return worker->translateIndependentObjects(toTranslate, begin, end); }));
+    }
+
+    bool success = true;
+    for (std::future<bool>& result : results) {
+      success = result.get() && success;
+    }
+    if (!success) {
+      LOG(Debug, "Objects of type " << objects.front().iddObject().name() << " could not be translated independently, translating serially.");
+      return false;
+    }
+
+    m_idfObjectOwners.resize(m_idfObjects.size());
+    for (const std::unique_ptr<ForwardTranslator>& worker : workers) {
+      m_idfObjects.insert(m_idfObjects.end(), worker->m_idfObjects.begin(), worker->m_idfObjects.end());
+      m_idfObjectOwners.insert(m_idfObjectOwners.end(), worker->m_idfObjectOwners.begin(), worker->m_idfObjectOwners.end());
+      m_map.insert(worker->m_map.begin(), worker->m_map.end());
+      std::vector<LogMessage> logMessages = worker->m_logSink.logMessages();
+      m_parallelLogMessages.insert(m_parallelLogMessages.end(), logMessages.begin(), logMessages.end());
+
+      // times are summed over the workers
+      for (const auto& workerEntry : worker->m_profileEntries) {
+        ForwardTranslatorProfileEntry& entry = m_profileEntries[workerEntry.first];
+        entry.iddObjectType = workerEntry.second.iddObjectType;
+        entry.calls += workerEntry.second.calls;
+        entry.inclusiveTime += workerEntry.second.inclusiveTime;
+        entry.exclusiveTime += workerEntry.second.exclusiveTime;
+        entry.idfObjects += workerEntry.second.idfObjects;
+      }
+    }
+
+    if (m_progressBar) {
+      m_progressBar->setValue((int)m_map.size());
+    }
+
+    return true;
+  }
+
+  bool ForwardTranslator::translateIndependentObjects(std::vector<model::ModelObject>& objects, std::size_t begin, std::size_t end) {
+    // sets the log sink to this thread
+    reset();
+
+    std::set<Handle> handles;
+    for (std::size_t i = begin; i < end; ++i) {
+      handles.insert(objects[i].handle());
+      translateAndMapModelObject(objects[i]);
+    }
+    m_idfObjectOwners.resize(m_idfObjects.size());
+
+    // any other object translated here, or any shared helper object, would also be created by the other workers
+    if (m_anyNumberScheduleTypeLimits || m_alwaysOnSchedule || m_alwaysOffSchedule) {
+      return false;
+    }
+    for (const auto& mapped : m_map) {
+      if (handles.find(mapped.first) == handles.end()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObjectByType(ModelObject& modelObject) {
+    boost::optional<IdfObject> retVal;
+
     LOG(Trace, "Translating " << modelObject.briefDescription() << ".");
 
     switch (modelObject.iddObject().type().value()) {
@@ -3344,6 +3655,10 @@ namespace energyplus {
       std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
       std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
 
+      if (m_parallelTranslation && translateIndependentObjectsInParallel(objects)) {
+        continue;
+      }
+
       for (const WorkspaceObject& workspaceObject : objects) {
         model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
         boost::optional<IdfObject> result = translateAndMapModelObject(modelObject);
@@ -3683,6 +3998,16 @@ namespace energyplus {
   void ForwardTranslator::reset() {
     m_idfObjects.clear();
 
+    m_idfObjectOwners.clear();
+
+    m_workspaceObjects.clear();
+
+    m_parallelLogMessages.clear();
+
+    m_retainedLogMessages.clear();
+
+    m_profileNestedTimes.clear();
+
     m_map.clear();
 
     m_anyNumberScheduleTypeLimits.reset();
@@ -39,6 +39,8 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 #include "../utilities/time/Time.hpp"
 
+#include <chrono>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -479,6 +481,41 @@ namespace energyplus {
     struct ForwardTranslatorInitializer;
   };
 
+  class ForwardTranslatorSession;
+
+  /** Time spent in one preprocessing step of ForwardTranslator, in seconds of wall time. */
+  struct ENERGYPLUS_API ForwardTranslatorProfileStep
+  {
+    std::string name;
+    double time = 0.0;
+  };
+
+  /** Calls, wall time in seconds and created IdfObjects for the translate function of one IddObjectType.  Exclusive time and
+   *  idfObjects do not count the nested translations of other ModelObjects. */
+  struct ENERGYPLUS_API ForwardTranslatorProfileEntry
+  {
+    IddObjectType iddObjectType;
+    unsigned calls = 0;
+    double inclusiveTime = 0.0;
+    double exclusiveTime = 0.0;
+    unsigned idfObjects = 0;
+  };
+
+  /** Profile of a ForwardTranslator translation, see ForwardTranslator::setProfileTranslation. */
+  struct ENERGYPLUS_API ForwardTranslatorProfile
+  {
+    double totalTime = 0.0;
+
+    /// preprocessing and bookkeeping steps in the order they ran
+    std::vector<ForwardTranslatorProfileStep> steps;
+
+    /// one entry per translated IddObjectType, by decreasing exclusive time
+    std::vector<ForwardTranslatorProfileEntry> entries;
+
+    /// the profile as a JSON document
+    std::string toJSON() const;
+  };
+
 #define ENERGYPLUS_VERSION "9.5"
 
   class ENERGYPLUS_API ForwardTranslator
@@ -530,9 +567,24 @@ namespace energyplus {
    *  Use this at your own risks */
     void setExcludeVariableDictionary(bool excludeVariableDictionary);
 
+    /** If parallelTranslation, families of objects that are translated from their own fields alone (curves and materials)
+   *  are split across worker threads when there are enough of them.  The resulting Workspace is identical to a serial translation.
+   *  The Model must not be modified by another thread during translation. */
+    void setParallelTranslation(bool parallelTranslation);
+
+    /** If profileTranslation, record the wall time, call count and created IdfObject count of each translated IddObjectType, and
+   *  the wall time of the preprocessing steps (clone, surface matching fixes, combining spaces, ...).  Off by default. */
+    void setProfileTranslation(bool profileTranslation);
+
+    /** Profile of the last translation, empty unless profiling was enabled before translating.
+   */
+    ForwardTranslatorProfile translationProfile() const;
+
    private:
     REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
 
+    friend class ForwardTranslatorSession;
+
     /** Translates the given Model to a workspace.  If fullModelTranslation is true
    *  various "front matter" objects (such as global geometry rules and others) are added to the workspace so that it is fully
    *  prepared for simulation.
@@ -552,6 +604,26 @@ namespace energyplus {
 
     boost::optional<IdfObject> translateAndMapModelObject(model::ModelObject& modelObject);
 
+    // dispatches to the type specific translate function, called by translateAndMapModelObject
+    boost::optional<IdfObject> translateAndMapModelObjectByType(model::ModelObject& modelObject);
+
+    // translates modelObject on its own and returns the IdfObjects owned by its translation, see m_idfObjectOwners
+    std::vector<IdfObject> translateOwnedIdfObjects(model::ModelObject& modelObject);
+
+    // records the time since start as a profile step and restarts start, does nothing unless profiling
+    void recordProfileStep(const std::string& name, std::chrono::steady_clock::time_point& start);
+
+    // records a step that ran before translateModelPrivate started the profile, such as cloning the model, does nothing unless profiling
+    void prependProfileStep(const std::string& name, const std::chrono::steady_clock::time_point& start,
+                            const std::chrono::steady_clock::time_point& end);
+
+    // translates the objects not yet translated on worker translators and appends their results in order, returns false
+    // without changing anything if the objects can not be translated independently of each other
+    bool translateIndependentObjectsInParallel(const std::vector<WorkspaceObject>& objects);
+
+    // worker side of translateIndependentObjectsInParallel, translates objects[begin, end) after a reset
+    bool translateIndependentObjects(std::vector<model::ModelObject>& objects, std::size_t begin, std::size_t end);
+
     boost::optional<IdfObject> translateAirConditionerVariableRefrigerantFlow(model::AirConditionerVariableRefrigerantFlow& modelObject);
 
     boost::optional<IdfObject> translateAirflowNetworkSimulationControl(model::AirflowNetworkSimulationControl& modelObject);
@@ -1546,6 +1618,20 @@ namespace energyplus {
 
     std::vector<IdfObject> m_idfObjects;
 
+    // handle of the ModelObject whose translation created each entry in m_idfObjects, objects created by a nested call
+    // to translateAndMapModelObject belong to the nested object, objects created outside of any translation have a null handle
+    std::vector<Handle> m_idfObjectOwners;
+
+    // if true, translateModelPrivate keeps the objects it added to the workspace, in the same order as m_idfObjects
+    bool m_keepWorkspaceObjects;
+    std::vector<WorkspaceObject> m_workspaceObjects;
+
+    // log messages of the worker translators used by translateIndependentObjectsInParallel
+    std::vector<LogMessage> m_parallelLogMessages;
+
+    // log messages of the translation patched by translateOwnedIdfObjects, merged with the ones of the re-translated objects
+    std::vector<LogMessage> m_retainedLogMessages;
+
     boost::optional<IdfObject> m_anyNumberScheduleTypeLimits;
 
     StringStreamLogSink m_logSink;
@@ -1558,6 +1644,14 @@ namespace energyplus {
     bool m_excludeSQliteOutputReport;  // exclude Output:Sqlite
     bool m_excludeHTMLOutputReport;    // exclude Output:Table:SummaryReports
     bool m_excludeVariableDictionary;  // exclude Output:VariableDictionary
+    bool m_parallelTranslation;
+
+    bool m_profileTranslation;
+    ForwardTranslatorProfile m_profile;
+    // per IddObjectType value, sorted into m_profile.entries by translationProfile
+    std::map<int, ForwardTranslatorProfileEntry> m_profileEntries;
+    // time spent in nested translations for each translateAndMapModelObject call in progress
+    std::vector<double> m_profileNestedTimes;
   };
 
 }  // namespace energyplus
@@ -0,0 +1,350 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ForwardTranslatorSession.hpp"
+
+#include "../model/Model_Impl.hpp"
+#include "../model/ModelObject.hpp"
+#include "../model/ModelObject_Impl.hpp"
+#include "../model/AdditionalProperties.hpp"
+#include "../model/AdditionalProperties_Impl.hpp"
+#include "../model/AirWallMaterial.hpp"
+#include "../model/AirWallMaterial_Impl.hpp"
+#include "../model/AvailabilityManager.hpp"
+#include "../model/AvailabilityManager_Impl.hpp"
+#include "../model/AvailabilityManagerAssignmentList.hpp"
+#include "../model/AvailabilityManagerAssignmentList_Impl.hpp"
+#include "../model/Building.hpp"
+#include "../model/Building_Impl.hpp"
+#include "../model/Connection.hpp"
+#include "../model/Connection_Impl.hpp"
+#include "../model/ConstructionBase.hpp"
+#include "../model/ConstructionBase_Impl.hpp"
+#include "../model/ControllerMechanicalVentilation.hpp"
+#include "../model/ControllerMechanicalVentilation_Impl.hpp"
+#include "../model/ControllerOutdoorAir.hpp"
+#include "../model/ControllerOutdoorAir_Impl.hpp"
+#include "../model/DaylightingControl.hpp"
+#include "../model/DaylightingControl_Impl.hpp"
+#include "../model/HVACComponent.hpp"
+#include "../model/HVACComponent_Impl.hpp"
+#include "../model/LifeCycleCost.hpp"
+#include "../model/LifeCycleCost_Impl.hpp"
+#include "../model/LifeCycleCostParameters.hpp"
+#include "../model/LifeCycleCostParameters_Impl.hpp"
+#include "../model/Loop.hpp"
+#include "../model/Loop_Impl.hpp"
+#include "../model/OutputMeter.hpp"
+#include "../model/OutputMeter_Impl.hpp"
+#include "../model/PlanarSurface.hpp"
+#include "../model/PlanarSurface_Impl.hpp"
+#include "../model/PlanarSurfaceGroup.hpp"
+#include "../model/PlanarSurfaceGroup_Impl.hpp"
+#include "../model/PlantEquipmentOperationScheme.hpp"
+#include "../model/PlantEquipmentOperationScheme_Impl.hpp"
+#include "../model/PortList.hpp"
+#include "../model/PortList_Impl.hpp"
+#include "../model/RunPeriodControlSpecialDays.hpp"
+#include "../model/RunPeriodControlSpecialDays_Impl.hpp"
+#include "../model/ShadingControl.hpp"
+#include "../model/ShadingControl_Impl.hpp"
+#include "../model/SizingPlant.hpp"
+#include "../model/SizingPlant_Impl.hpp"
+#include "../model/SizingSystem.hpp"
+#include "../model/SizingSystem_Impl.hpp"
+#include "../model/SizingZone.hpp"
+#include "../model/SizingZone_Impl.hpp"
+#include "../model/SpaceLoad.hpp"
+#include "../model/SpaceLoad_Impl.hpp"
+#include "../model/SpaceType.hpp"
+#include "../model/SpaceType_Impl.hpp"
+#include "../model/ThermalZone.hpp"
+#include "../model/ThermalZone_Impl.hpp"
+#include "../model/UtilityBill.hpp"
+#include "../model/UtilityBill_Impl.hpp"
+#include "../model/Version.hpp"
+#include "../model/Version_Impl.hpp"
+#include "../model/ZoneHVACEquipmentList.hpp"
+#include "../model/ZoneHVACEquipmentList_Impl.hpp"
+
+#include "../utilities/idd/IddObject.hpp"
+#include "../utilities/idd/IddField.hpp"
+#include "../utilities/idf/Workspace_Impl.hpp"
+#include "../utilities/core/Assert.hpp"
+
+using namespace openstudio::model;
+
+namespace openstudio {
+
+namespace energyplus {
+
+  namespace {
+
+    // true if the two objects print the same, pointer fields are compared by target name
+    bool sameFields(const IdfObject& lhs, const IdfObject& rhs) {
+      if ((lhs.iddObject().type() != rhs.iddObject().type()) || (lhs.numFields() != rhs.numFields())) {
+        return false;
+      }
+      for (unsigned i = 0, n = lhs.numFields(); i < n; ++i) {
+        if (lhs.getString(i) != rhs.getString(i)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // copies the fields of source onto target, both objects must share the same handles for their pointers
+    bool copyFields(const WorkspaceObject& source, WorkspaceObject& target) {
+      if ((source.iddObject().type() != target.iddObject().type()) || (source.numFields() != target.numFields())) {
+        return false;
+      }
+      for (unsigned i = 0, n = source.numFields(); i < n; ++i) {
+        boost::optional<IddField> iddField = source.iddObject().getField(i);
+        if (iddField && iddField->isObjectListField()) {
+          boost::optional<WorkspaceObject> sourceTarget = source.getTarget(i);
+          boost::optional<WorkspaceObject> targetTarget = target.getTarget(i);
+          if (sourceTarget && targetTarget && (sourceTarget->handle() == targetTarget->handle())) {
+            continue;
+          }
+          if (!sourceTarget) {
+            if (targetTarget && !target.setString(i, "")) {
+              return false;
+            }
+          } else if (!target.setPointer(i, sourceTarget->handle())) {
+            return false;
+          }
+        } else if (source.getString(i) != target.getString(i)) {
+          boost::optional<std::string> value = source.getString(i);
+          if (!target.setString(i, value ? *value : std::string())) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  }  // namespace
+
+  ForwardTranslatorSession::ForwardTranslatorSession(const Model& model)
+    : m_model(model), m_structureChanged(true), m_lastTranslationWasIncremental(false) {
+    std::shared_ptr<openstudio::detail::Workspace_Impl> impl = m_model.getImpl<openstudio::detail::Workspace_Impl>();
+    impl->onObjectChange.connect<ForwardTranslatorSession, &ForwardTranslatorSession::objectChange>(this);
+    impl->addWorkspaceObject.connect<ForwardTranslatorSession, &ForwardTranslatorSession::objectAddOrRemove>(this);
+    impl->removeWorkspaceObject.connect<ForwardTranslatorSession, &ForwardTranslatorSession::objectAddOrRemove>(this);
+  }
+
+  Workspace ForwardTranslatorSession::translateModel() {
+    m_lastTranslationWasIncremental = false;
+    if (m_workspace && !m_structureChanged) {
+      m_lastTranslationWasIncremental = translateDirtyObjects();
+    }
+
+    if (!m_lastTranslationWasIncremental) {
+      translateFull();
+    }
+
+    m_dirtyHandles.clear();
+    m_structureChanged = false;
+
+    OS_ASSERT(m_workspace);
+    return *m_workspace;
+  }
+
+  bool ForwardTranslatorSession::lastTranslationWasIncremental() const {
+    return m_lastTranslationWasIncremental;
+  }
+
+  ForwardTranslator& ForwardTranslatorSession::forwardTranslator() {
+    return m_forwardTranslator;
+  }
+
+  void ForwardTranslatorSession::resetTranslation() {
+    m_structureChanged = true;
+  }
+
+  void ForwardTranslatorSession::objectChange(const openstudio::UUID& handle) {
+    m_dirtyHandles.insert(handle);
+  }
+
+  void ForwardTranslatorSession::objectAddOrRemove(const WorkspaceObject& /*object*/, const openstudio::IddObjectType& /*iddObjectType*/,
+                                                   const openstudio::UUID& /*handle*/) {
+    m_structureChanged = true;
+  }
+
+  void ForwardTranslatorSession::translateFull() {
+    m_ownedObjects.clear();
+
+    // same as ForwardTranslator::translateModel, but keeping the handles and the prepared copy
+    m_modelCopy = m_model.clone(true).cast<Model>();
+    m_forwardTranslator.m_progressBar = nullptr;
+    m_forwardTranslator.m_keepWorkspaceObjects = true;
+    m_workspace = m_forwardTranslator.translateModelPrivate(*m_modelCopy, true);
+    m_forwardTranslator.m_keepWorkspaceObjects = false;
+
+    std::vector<Handle>& owners = m_forwardTranslator.m_idfObjectOwners;
+    const std::vector<WorkspaceObject>& workspaceObjects = m_forwardTranslator.m_workspaceObjects;
+    owners.resize(m_forwardTranslator.m_idfObjects.size());
+    if (workspaceObjects.size() != owners.size()) {
+      LOG(Warn, "Could not map translated objects to the Workspace, the next translation will not be incremental.");
+      m_modelCopy.reset();
+      return;
+    }
+
+    for (std::size_t i = 0, n = owners.size(); i < n; ++i) {
+      if (!owners[i].isNull()) {
+        m_ownedObjects[owners[i]].push_back(workspaceObjects[i]);
+      }
+    }
+  }
+
+  bool ForwardTranslatorSession::translateDirtyObjects() {
+    if (!m_modelCopy) {
+      return false;
+    }
+
+    // the dirty objects and the objects whose translation may read them
+    std::vector<ModelObject> toTranslate;
+    std::set<Handle> toTranslateHandles;
+    auto addToTranslate = [&](const WorkspaceObject& object) {
+      if (toTranslateHandles.insert(object.handle()).second) {
+        toTranslate.push_back(object.cast<ModelObject>());
+      }
+    };
+
+    std::vector<std::pair<ModelObject, ModelObject>> changed;
+    for (const Handle& handle : m_dirtyHandles) {
+      boost::optional<ModelObject> source = m_model.getModelObject<ModelObject>(handle);
+      boost::optional<ModelObject> copy = m_modelCopy->getModelObject<ModelObject>(handle);
+      if (!source || !copy || !isIncrementallyTranslatable(*copy)) {
+        return false;
+      }
+      changed.push_back(std::make_pair(*source, *copy));
+
+      addToTranslate(*copy);
+      for (const WorkspaceObject& object : copy->sources()) {
+        addToTranslate(object);
+      }
+      for (const WorkspaceObject& object : copy->targets()) {
+        addToTranslate(object);
+      }
+    }
+
+    const std::vector<WorkspaceObject> empty;
+    auto ownedObjects = [&](const Handle& handle) -> const std::vector<WorkspaceObject>& {
+      auto it = m_ownedObjects.find(handle);
+      return (it == m_ownedObjects.end()) ? empty : it->second;
+    };
+
+    // translating each object on its own must reproduce the previous translation, otherwise it depends on
+    // translation order or on objects that are not being re-translated
+    for (ModelObject& modelObject : toTranslate) {
+      std::vector<IdfObject> idfObjects = m_forwardTranslator.translateOwnedIdfObjects(modelObject);
+      const std::vector<WorkspaceObject>& previous = ownedObjects(modelObject.handle());
+      if (idfObjects.size() != previous.size()) {
+        return false;
+      }
+      for (std::size_t i = 0, n = idfObjects.size(); i < n; ++i) {
+        if (!sameFields(idfObjects[i], previous[i])) {
+          return false;
+        }
+      }
+    }
+
+    // from here on the model copy is modified, a full translation will re-clone it if we bail out
+    for (auto& sourceAndCopy : changed) {
+      if (!copyFields(sourceAndCopy.first, sourceAndCopy.second)) {
+        return false;
+      }
+    }
+
+    std::vector<std::pair<WorkspaceObject, IdfObject>> patches;
+    for (ModelObject& modelObject : toTranslate) {
+      std::vector<IdfObject> idfObjects = m_forwardTranslator.translateOwnedIdfObjects(modelObject);
+      const std::vector<WorkspaceObject>& previous = ownedObjects(modelObject.handle());
+      if (idfObjects.size() != previous.size()) {
+        return false;
+      }
+      for (std::size_t i = 0, n = idfObjects.size(); i < n; ++i) {
+        // names must be kept, other objects in the workspace refer to them
+        if ((idfObjects[i].iddObject().type() != previous[i].iddObject().type()) || (idfObjects[i].numFields() != previous[i].numFields())
+            || (idfObjects[i].name() != previous[i].name())) {
+          return false;
+        }
+        if (!sameFields(idfObjects[i], previous[i])) {
+          // the new translation of a loop connected object may change objects beyond the ones re-translated here
+          if (isLoopConnected(modelObject)) {
+            return false;
+          }
+          patches.push_back(std::make_pair(previous[i], idfObjects[i]));
+        }
+      }
+    }
+
+    for (auto& patch : patches) {
+      WorkspaceObject& workspaceObject = patch.first;
+      const IdfObject& idfObject = patch.second;
+      for (unsigned i = 0, n = idfObject.numFields(); i < n; ++i) {
+        boost::optional<std::string> value = idfObject.getString(i);
+        if ((value != workspaceObject.getString(i)) && !workspaceObject.setString(i, value ? *value : std::string())) {
+          LOG(Warn, "Could not patch " << workspaceObject.briefDescription() << ", translating the whole model.");
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  bool ForwardTranslatorSession::isIncrementallyTranslatable(const ModelObject& modelObject) const {
+    // these objects are rewritten, cloned, combined or removed by translateModelPrivate before they are translated,
+    // changes to them can not be replayed on the prepared model copy
+    return !(modelObject.optionalCast<PlanarSurface>() || modelObject.optionalCast<PlanarSurfaceGroup>()
+             || modelObject.optionalCast<ConstructionBase>() || modelObject.optionalCast<AirWallMaterial>()
+             || modelObject.optionalCast<SpaceLoad>() || modelObject.optionalCast<SpaceType>() || modelObject.optionalCast<ThermalZone>()
+             || modelObject.optionalCast<DaylightingControl>() || modelObject.optionalCast<ShadingControl>()
+             || modelObject.optionalCast<AdditionalProperties>() || modelObject.optionalCast<RunPeriodControlSpecialDays>()
+             || modelObject.optionalCast<LifeCycleCost>() || modelObject.optionalCast<LifeCycleCostParameters>()
+             || modelObject.optionalCast<UtilityBill>() || modelObject.optionalCast<OutputMeter>() || modelObject.optionalCast<Building>()
+             || modelObject.optionalCast<Version>() || isLoopConnected(modelObject));
+  }
+
+  bool ForwardTranslatorSession::isLoopConnected(const ModelObject& modelObject) const {
+    // the translation of a loop reads the objects connected to it, e.g. the plant equipment operation schemes written with a
+    // PlantLoop depend on the capacity of its boilers, so a change can affect objects that do not point to the changed one
+    return (modelObject.optionalCast<HVACComponent>() || modelObject.optionalCast<Loop>() || modelObject.optionalCast<AvailabilityManager>()
+            || modelObject.optionalCast<AvailabilityManagerAssignmentList>() || modelObject.optionalCast<PlantEquipmentOperationScheme>()
+            || modelObject.optionalCast<SizingPlant>() || modelObject.optionalCast<SizingSystem>() || modelObject.optionalCast<SizingZone>()
+            || modelObject.optionalCast<ControllerOutdoorAir>() || modelObject.optionalCast<ControllerMechanicalVentilation>()
+            || modelObject.optionalCast<ZoneHVACEquipmentList>() || modelObject.optionalCast<PortList>()
+            || modelObject.optionalCast<Connection>());
+  }
+
+}  // namespace energyplus
+
+}  // namespace openstudio
@@ -0,0 +1,120 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef ENERGYPLUS_FORWARDTRANSLATORSESSION_HPP
+#define ENERGYPLUS_FORWARDTRANSLATORSESSION_HPP
+
+#include "EnergyPlusAPI.hpp"
+#include "ForwardTranslator.hpp"
+#include "../model/Model.hpp"
+#include "../utilities/idf/Workspace.hpp"
+#include "../utilities/idf/WorkspaceObject.hpp"
+#include "../utilities/core/Logger.hpp"
+
+#include <nano/nano_signal_slot.hpp>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace openstudio {
+
+namespace model {
+  class ModelObject;
+}
+
+namespace energyplus {
+
+  /** ForwardTranslatorSession keeps the result of translating a Model to EnergyPlus between calls to translateModel.
+   *  The session watches the Model for changes, when only object fields have changed the next translation re-translates
+   *  the changed objects and the objects directly pointing to or pointed to by them, and patches the previously returned
+   *  Workspace in place.  Any change that the incremental update can not prove equivalent to a full translation (objects
+   *  added or removed, renamed translated objects, objects rewritten before translation such as geometry, space loads
+   *  and constructions, HVAC components, loops and the objects attached to them, or objects whose translation depends on
+   *  the rest of the model) falls back to a full translation which returns a new Workspace. */
+  class ENERGYPLUS_API ForwardTranslatorSession : public Nano::Observer
+  {
+   public:
+    ForwardTranslatorSession(const model::Model& model);
+
+    virtual ~ForwardTranslatorSession() {}
+
+    /** Translates the watched Model, re-using the previous translation when possible. */
+    Workspace translateModel();
+
+    /** True if the last call to translateModel patched the previous Workspace instead of translating the whole Model. */
+    bool lastTranslationWasIncremental() const;
+
+    /** The translator used by this session, options set here apply to subsequent translations.  Changing options does not
+     *  invalidate the previous translation, call resetTranslation to force a full translation. */
+    ForwardTranslator& forwardTranslator();
+
+    /** Discards the previous translation, the next call to translateModel translates the whole Model. */
+    void resetTranslation();
+
+    // slots
+    void objectChange(const openstudio::UUID& handle);
+
+    void objectAddOrRemove(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+
+   private:
+    REGISTER_LOGGER("openstudio.energyplus.ForwardTranslatorSession");
+
+    void translateFull();
+
+    bool translateDirtyObjects();
+
+    bool isIncrementallyTranslatable(const model::ModelObject& modelObject) const;
+
+    bool isLoopConnected(const model::ModelObject& modelObject) const;
+
+    model::Model m_model;
+
+    // copy of m_model as prepared by the last full translation, keeps the handles of m_model
+    boost::optional<model::Model> m_modelCopy;
+
+    boost::optional<Workspace> m_workspace;
+
+    ForwardTranslator m_forwardTranslator;
+
+    // objects in m_workspace created by the translation of each ModelObject, see ForwardTranslator::m_idfObjectOwners
+    std::map<Handle, std::vector<WorkspaceObject>> m_ownedObjects;
+
+    std::set<Handle> m_dirtyHandles;
+
+    bool m_structureChanged;
+
+    bool m_lastTranslationWasIncremental;
+  };
+
+}  // namespace energyplus
+
+}  // namespace openstudio
+
+#endif  // ENERGYPLUS_FORWARDTRANSLATORSESSION_HPP
@@ -0,0 +1,157 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "EnergyPlusFixture.hpp"
+
+#include "../ForwardTranslator.hpp"
+#include "../ForwardTranslatorSession.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/BoilerHotWater.hpp"
+#include "../../model/Construction.hpp"
+#include "../../model/PlantLoop.hpp"
+#include "../../model/StandardOpaqueMaterial.hpp"
+
+#include "../../utilities/idf/IdfFile.hpp"
+#include "../../utilities/idf/IdfObject.hpp"
+#include "../../utilities/idf/Workspace.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace openstudio::energyplus;
+using namespace openstudio::model;
+using namespace openstudio;
+
+namespace {
+
+// printed objects of the workspace, sorted so that object order does not matter
+std::vector<std::string> printedObjects(const Workspace& workspace) {
+  std::vector<std::string> result;
+  for (const IdfObject& object : workspace.toIdfFile().objects()) {
+    std::stringstream ss;
+    object.print(ss);
+    result.push_back(ss.str());
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+}  // namespace
+
+TEST_F(EnergyPlusFixture, ForwardTranslatorSession_MatchesFullTranslation) {
+  Model model;
+
+  StandardOpaqueMaterial material(model);
+  material.setName("Material");
+  material.setThickness(0.1);
+
+  Construction construction(model);
+  construction.setName("Construction");
+  std::vector<Material> layers;
+  layers.push_back(material);
+  EXPECT_TRUE(construction.setLayers(layers));
+
+  ForwardTranslatorSession session(model);
+
+  Workspace workspace = session.translateModel();
+  EXPECT_FALSE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(printedObjects(ForwardTranslator().translateModel(model)), printedObjects(workspace));
+
+  // nothing changed, nothing to re-translate
+  Workspace workspace2 = session.translateModel();
+  EXPECT_TRUE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(workspace, workspace2);
+
+  // a data change is patched into the previous workspace
+  EXPECT_TRUE(material.setThickness(0.2));
+  workspace2 = session.translateModel();
+  EXPECT_TRUE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(workspace, workspace2);
+  EXPECT_EQ(printedObjects(ForwardTranslator().translateModel(model)), printedObjects(workspace));
+
+  // renaming changes the objects referring to it, translate everything
+  material.setName("Renamed Material");
+  workspace2 = session.translateModel();
+  EXPECT_FALSE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(printedObjects(ForwardTranslator().translateModel(model)), printedObjects(workspace2));
+
+  // adding objects translates everything
+  StandardOpaqueMaterial material2(model);
+  workspace2 = session.translateModel();
+  EXPECT_FALSE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(printedObjects(ForwardTranslator().translateModel(model)), printedObjects(workspace2));
+
+  // and the new translation can be patched again
+  Workspace workspace3 = workspace2;
+  EXPECT_TRUE(material2.setThickness(0.3));
+  workspace2 = session.translateModel();
+  EXPECT_TRUE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(workspace3, workspace2);
+  EXPECT_EQ(printedObjects(ForwardTranslator().translateModel(model)), printedObjects(workspace2));
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslatorSession_HVACMatchesFullTranslation) {
+  Model model;
+
+  PlantLoop plantLoop(model);
+  BoilerHotWater boiler(model);
+  EXPECT_TRUE(plantLoop.addSupplyBranchForComponent(boiler));
+  EXPECT_TRUE(boiler.setNominalCapacity(10000.0));
+
+  StandardOpaqueMaterial material(model);
+  material.setThickness(0.1);
+  Construction construction(model);
+  std::vector<Material> layers;
+  layers.push_back(material);
+  EXPECT_TRUE(construction.setLayers(layers));
+
+  ForwardTranslatorSession session(model);
+  session.translateModel();
+  EXPECT_FALSE(session.lastTranslationWasIncremental());
+
+  ForwardTranslator forwardTranslator;
+
+  // the boiler capacity is read by the plant equipment operation written with the loop, translate everything
+  EXPECT_TRUE(boiler.setNominalCapacity(20000.0));
+  Workspace workspace = session.translateModel();
+  EXPECT_FALSE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(printedObjects(forwardTranslator.translateModel(model)), printedObjects(workspace));
+
+  // patching keeps the warnings and errors of the translation being patched
+  EXPECT_TRUE(material.setThickness(0.2));
+  workspace = session.translateModel();
+  EXPECT_TRUE(session.lastTranslationWasIncremental());
+  EXPECT_EQ(printedObjects(forwardTranslator.translateModel(model)), printedObjects(workspace));
+  EXPECT_EQ(forwardTranslator.warnings().size(), session.forwardTranslator().warnings().size());
+  EXPECT_EQ(forwardTranslator.errors().size(), session.forwardTranslator().errors().size());
+}
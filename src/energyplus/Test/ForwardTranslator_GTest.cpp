@@ -60,6 +60,7 @@
 #include "../../model/CurveBiquadratic_Impl.hpp"
 #include "../../model/CurveQuadratic.hpp"
 #include "../../model/CurveQuadratic_Impl.hpp"
+#include "../../model/CurveLinear.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
@@ -94,6 +95,7 @@
 
 #include <sstream>
 
+#include <algorithm>
 #include <vector>
 
 using namespace openstudio::energyplus;
@@ -678,6 +680,85 @@ TEST_F(EnergyPlusFixture, ForwardTranslatorTest_MultiThreadedLogMessages) {
   }
 }
 
+TEST_F(EnergyPlusFixture, ForwardTranslatorTest_ParallelTranslation) {
+  Model model;
+  for (int i = 0; i < 500; ++i) {
+    CurveLinear curve(model);
+    curve.setCoefficient1Constant(i);
+    StandardOpaqueMaterial material(model);
+    material.setThickness(0.01 * (i + 1));
+  }
+
+  ForwardTranslator serialTranslator;
+  Workspace serialWorkspace = serialTranslator.translateModel(model);
+
+  ForwardTranslator parallelTranslator;
+  parallelTranslator.setParallelTranslation(true);
+  Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+
+  EXPECT_EQ(500u, parallelWorkspace.getObjectsByType(IddObjectType::Curve_Linear).size());
+  EXPECT_EQ(500u, parallelWorkspace.getObjectsByType(IddObjectType::Material).size());
+  EXPECT_EQ(serialTranslator.warnings().size(), parallelTranslator.warnings().size());
+
+  // same objects in the same order
+  std::stringstream serialIdf;
+  serialIdf << serialWorkspace.toIdfFile();
+  std::stringstream parallelIdf;
+  parallelIdf << parallelWorkspace.toIdfFile();
+  EXPECT_EQ(serialIdf.str(), parallelIdf.str());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslatorTest_TranslationProfile) {
+  Model model;
+  ThermalZone thermalZone(model);
+  Space space(model);
+  space.setThermalZone(thermalZone);
+
+  ForwardTranslator translator;
+  translator.translateModel(model);
+  ForwardTranslatorProfile profile = translator.translationProfile();
+  EXPECT_TRUE(profile.steps.empty());
+  EXPECT_TRUE(profile.entries.empty());
+
+  translator.setProfileTranslation(true);
+  translator.translateModel(model);
+  profile = translator.translationProfile();
+  EXPECT_LT(0.0, profile.totalTime);
+
+  std::vector<std::string> stepNames;
+  for (const ForwardTranslatorProfileStep& step : profile.steps) {
+    EXPECT_LE(0.0, step.time);
+    stepNames.push_back(step.name);
+  }
+  EXPECT_NE(stepNames.end(), std::find(stepNames.begin(), stepNames.end(), "Clone model"));
+  EXPECT_NE(stepNames.end(), std::find(stepNames.begin(), stepNames.end(), "Combine spaces"));
+  EXPECT_NE(stepNames.end(), std::find(stepNames.begin(), stepNames.end(), "Resolve matched surface construction conflicts"));
+
+  auto zoneEntry = std::find_if(profile.entries.begin(), profile.entries.end(), [](const ForwardTranslatorProfileEntry& entry) {
+    return entry.iddObjectType == IddObjectType::OS_ThermalZone;
+  });
+  ASSERT_NE(profile.entries.end(), zoneEntry);
+  EXPECT_EQ(1u, zoneEntry->calls);
+  EXPECT_LE(1u, zoneEntry->idfObjects);
+  EXPECT_LE(zoneEntry->exclusiveTime, zoneEntry->inclusiveTime);
+
+  for (size_t i = 1; i < profile.entries.size(); ++i) {
+    EXPECT_GE(profile.entries[i - 1].exclusiveTime, profile.entries[i].exclusiveTime);
+  }
+
+  std::string json = profile.toJSON();
+  EXPECT_NE(std::string::npos, json.find("\"total_time\""));
+  EXPECT_NE(std::string::npos, json.find("\"OS:ThermalZone\""));
+
+  // the clone comes first and a new translation starts a new profile
+  ASSERT_FALSE(profile.steps.empty());
+  EXPECT_EQ("Clone model", profile.steps.front().name);
+  translator.translateModel(model);
+  ForwardTranslatorProfile secondProfile = translator.translationProfile();
+  EXPECT_EQ(profile.steps.size(), secondProfile.steps.size());
+  EXPECT_EQ(profile.entries.size(), secondProfile.entries.size());
+}
+
 TEST_F(EnergyPlusFixture, ForwardTranslatorTest_TranslateZoneCapacitanceMultiplierResearchSpecial) {
   openstudio::model::Model model;
   openstudio::model::ZoneCapacitanceMultiplierResearchSpecial zcm =
@@ -64,6 +64,10 @@
 
 #include <boost/regex.hpp>
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -335,6 +339,28 @@ namespace model {
       return m_cachedYearDescription;
     }
 
+    std::vector<IddObjectType> Model_Impl::iddObjectTypesOfFamily(const std::type_index& implType,
+                                                                  const std::function<bool(const WorkspaceObject&)>& isInstance) const {
+      std::vector<IddObjectType> result;
+      std::map<IddObjectType, bool>& family = m_typeFamilies[implType];
+      for (const IddObjectType& type : iddObjectTypes()) {
+        // the version object is not reported by objects(), keep it out of the families too
+        if (type == IddObjectType::OS_Version) {
+          continue;
+        }
+        auto it = family.find(type);
+        if (it == family.end()) {
+          std::vector<WorkspaceObject> candidates = getObjectsByType(type);
+          OS_ASSERT(!candidates.empty());
+          it = family.insert(std::make_pair(type, isInstance(candidates.front()))).first;
+        }
+        if (it->second) {
+          result.push_back(type);
+        }
+      }
+      return result;
+    }
+
     boost::optional<PerformancePrecisionTradeoffs> Model_Impl::performancePrecisionTradeoffs() const {
       if (m_cachedPerformancePrecisionTradeoffs) {
         return m_cachedPerformancePrecisionTradeoffs;
@@ -760,14 +786,57 @@ namespace model {
     }
 
     std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects() {
-      ResourceObjectVector resources = model().getModelObjects<ResourceObject>();
+      // A resource is used if a non-resource object that is not one of its children points to it, or
+      // if a used resource points to it. Mark from the non-resource objects over the pointer graph
+      // once, then remove everything unmarked.
+      std::vector<IddObjectType> resourceTypes = iddObjectTypesOfFamily(
+        typeid(ResourceObject_Impl), [](const WorkspaceObject& object) { return static_cast<bool>(object.getImpl<ResourceObject_Impl>()); });
+      auto isResource = [&resourceTypes](const WorkspaceObject& object) {
+        return std::binary_search(resourceTypes.begin(), resourceTypes.end(), object.iddObject().type());
+      };
+
+      std::vector<WorkspaceObject> allObjects = objects();
+      std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> marked;
+      std::vector<WorkspaceObject> toVisit;
+      std::unordered_map<Handle, std::vector<Handle>, boost::hash<boost::uuids::uuid>> childHandles;
+      for (const WorkspaceObject& object : allObjects) {
+        if (isResource(object)) {
+          continue;
+        }
+        for (const WorkspaceObject& target : object.targets()) {
+          if (!isResource(target) || (marked.find(target.handle()) != marked.end())) {
+            continue;
+          }
+          auto it = childHandles.find(target.handle());
+          if (it == childHandles.end()) {
+            it = childHandles.insert(std::make_pair(target.handle(), getHandles(target.cast<ResourceObject>().children()))).first;
+          }
+          if (std::find(it->second.begin(), it->second.end(), object.handle()) == it->second.end()) {
+            marked.insert(target.handle());
+            toVisit.push_back(target);
+          }
+        }
+      }
+      while (!toVisit.empty()) {
+        WorkspaceObject resource = toVisit.back();
+        toVisit.pop_back();
+        for (const WorkspaceObject& target : resource.targets()) {
+          if (isResource(target) && marked.insert(target.handle()).second) {
+            toVisit.push_back(target);
+          }
+        }
+      }
+
+      // sweep: remove the unmarked resources through their own remove, which takes their children and
+      // runs type-specific cleanup such as deleting the file of an ExternalFile
       IdfObjectVector removedObjects;
-      for (ResourceObject& resource : resources) {
+      for (const WorkspaceObject& object : allObjects) {
         // test for initialized first in case earlier .remove() got this one already
-        if ((resource.initialized()) && (resource.nonResourceObjectUseCount(true) == 0)) {
-          IdfObjectVector thisCallRemoved = resource.remove();
-          removedObjects.insert(removedObjects.end(), thisCallRemoved.begin(), thisCallRemoved.end());
+        if (!object.initialized() || !isResource(object) || (marked.find(object.handle()) != marked.end())) {
+          continue;
         }
+        IdfObjectVector thisCallRemoved = object.cast<ResourceObject>().remove();
+        removedObjects.insert(removedObjects.end(), thisCallRemoved.begin(), thisCallRemoved.end());
       }
       return removedObjects;
     }
@@ -1270,6 +1339,11 @@ namespace model {
     return (getImpl<detail::Model_Impl>() == other.getImpl<detail::Model_Impl>());
   }
 
+  std::vector<IddObjectType> Model::iddObjectTypesOfFamily(const std::type_index& implType,
+                                                           const std::function<bool(const WorkspaceObject&)>& isInstance) const {
+    return getImpl<detail::Model_Impl>()->iddObjectTypesOfFamily(implType, isInstance);
+  }
+
   std::vector<ModelObject> Model::modelObjects(bool sorted) const {
     // can't use resize because ModelObject has no default ctor
     std::vector<ModelObject> result;
@@ -1279,6 +1353,165 @@ namespace model {
     return result;
   }
 
+  // objects whose clone override does more than copy the object, its children, life cycle costs and additional properties,
+  // e.g. reconnecting HVAC nodes or copying surface properties that point to the object, Workspace::addCopies cannot reproduce it
+  static bool hasCloneOverride(const WorkspaceObject& object) {
+    static const std::set<IddObjectType> types{AirLoopHVACDedicatedOutdoorAirSystem::iddObjectType(),
+                                               AvailabilityManagerAssignmentList::iddObjectType(),
+                                               AvailabilityManagerHybridVentilation::iddObjectType(),
+                                               AvailabilityManagerNightCycle::iddObjectType(),
+                                               CentralHeatPumpSystemModule::iddObjectType(),
+                                               CoilCoolingDXCurveFitOperatingMode::iddObjectType(),
+                                               CoilCoolingDXCurveFitPerformance::iddObjectType(),
+                                               CoilCoolingDXCurveFitSpeed::iddObjectType(),
+                                               CoilCoolingDXMultiSpeedStageData::iddObjectType(),
+                                               CoilCoolingDXVariableSpeedSpeedData::iddObjectType(),
+                                               CoilCoolingWaterToAirHeatPumpVariableSpeedEquationFitSpeedData::iddObjectType(),
+                                               CoilHeatingDXMultiSpeedStageData::iddObjectType(),
+                                               CoilHeatingDXVariableSpeedSpeedData::iddObjectType(),
+                                               CoilHeatingWaterToAirHeatPumpVariableSpeedEquationFitSpeedData::iddObjectType(),
+                                               CoilPerformanceDXCooling::iddObjectType(),
+                                               CoilWaterHeatingAirToWaterHeatPumpVariableSpeedSpeedData::iddObjectType(),
+                                               ControllerOutdoorAir::iddObjectType(),
+                                               ElectricLoadCenterDistribution::iddObjectType(),
+                                               ElectricLoadCenterStorageSimple::iddObjectType(),
+                                               ExternalFile::iddObjectType(),
+                                               FoundationKiva::iddObjectType(),
+                                               GeneratorFuelCell::iddObjectType(),
+                                               GeneratorMicroTurbine::iddObjectType(),
+                                               GeneratorPhotovoltaic::iddObjectType(),
+                                               InternalMass::iddObjectType(),
+                                               ModelObjectList::iddObjectType(),
+                                               RefrigerationCase::iddObjectType(),
+                                               RefrigerationCompressor::iddObjectType(),
+                                               RefrigerationCondenserAirCooled::iddObjectType(),
+                                               RefrigerationCondenserEvaporativeCooled::iddObjectType(),
+                                               RefrigerationGasCoolerAirCooled::iddObjectType(),
+                                               RefrigerationSecondarySystem::iddObjectType(),
+                                               RefrigerationSubcoolerMechanical::iddObjectType(),
+                                               RefrigerationSystem::iddObjectType(),
+                                               RefrigerationTranscriticalSystem::iddObjectType(),
+                                               RefrigerationWalkIn::iddObjectType(),
+                                               RefrigerationWalkInZoneBoundary::iddObjectType(),
+                                               ShadingControl::iddObjectType(),
+                                               SubSurface::iddObjectType(),
+                                               Surface::iddObjectType(),
+                                               SurfaceControlMovableInsulation::iddObjectType(),
+                                               SurfacePropertyConvectionCoefficients::iddObjectType(),
+                                               ZoneControlContaminantController::iddObjectType(),
+                                               ZonePropertyUserViewFactorsBySurfaceName::iddObjectType()};
+    return (types.find(object.iddObject().type()) != types.end()) || object.optionalCast<HVACComponent>() || object.optionalCast<Loop>()
+           || object.optionalCast<PlantEquipmentOperationRangeBasedScheme>();
+  }
+
+  std::vector<ModelObject> Model::cloneMany(const std::vector<ModelObject>& objects, Model& model, const CloneOptions& options) {
+    std::vector<ModelObject> result;
+    if (objects.empty() || (options.numberOfCopies == 0)) {
+      return result;
+    }
+
+    Model sourceModel = objects[0].model();
+    for (const ModelObject& object : objects) {
+      if (object.model() != sourceModel) {
+        LOG_FREE(Error, "openstudio.model.Model", "Unable to clone " << object.briefDescription() << ", all objects must be in the same model.");
+        return result;
+      }
+      if (object.iddObject().properties().unique) {
+        LOG_FREE(Error, "openstudio.model.Model", "Unable to clone " << object.briefDescription() << " more than once, it is a unique object.");
+        return result;
+      }
+    }
+
+    // transitive closure of the objects copied in bulk, each object listed once
+    std::vector<WorkspaceObject> closure;
+    std::map<Handle, unsigned> closureIndices;
+    // objects cloned one at a time because they or one of their children need their clone override
+    std::vector<bool> cloneOneByOne(objects.size(), false);
+    for (unsigned i = 0; i < objects.size(); ++i) {
+      const ModelObject& object = objects[i];
+      if (closureIndices.find(object.handle()) != closureIndices.end()) {
+        continue;
+      }
+      std::vector<ModelObject> members;
+      boost::optional<ParentObject> parent = object.optionalCast<ParentObject>();
+      if (parent && options.includeChildren) {
+        members = getRecursiveChildren(*parent, options.includeLifeCycleCostsAndAdditionalProperties, true);
+      } else {
+        members.push_back(object);
+        if (options.includeLifeCycleCostsAndAdditionalProperties) {
+          for (const LifeCycleCost& lifeCycleCost : object.lifeCycleCosts()) {
+            members.push_back(lifeCycleCost);
+          }
+          if (object.hasAdditionalProperties()) {
+            members.push_back(object.additionalProperties());
+          }
+        }
+      }
+
+      if (std::any_of(members.begin(), members.end(), [](const ModelObject& member) { return hasCloneOverride(member); })) {
+        cloneOneByOne[i] = true;
+        continue;
+      }
+      for (const ModelObject& member : members) {
+        if (closureIndices.insert(std::make_pair(member.handle(), static_cast<unsigned>(closure.size()))).second) {
+          closure.push_back(member);
+        }
+      }
+    }
+
+    std::vector<WorkspaceObject> copies;
+    if (closure.empty()) {
+      // everything goes through clone
+    } else if (sourceModel == model) {
+      copies = model.addCopies(closure, options.numberOfCopies);
+    } else {
+      // bring the closure and its resources over once, then copy that first copy
+      std::vector<std::vector<WorkspaceObject>> resourceSubTrees;
+      std::set<Handle> resourceRoots;
+      for (const WorkspaceObject& member : closure) {
+        for (const std::vector<ModelObject>& subTree : getRecursiveResourceSubTrees(member.cast<ModelObject>(), true)) {
+          if ((closureIndices.find(subTree[0].handle()) == closureIndices.end()) && resourceRoots.insert(subTree[0].handle()).second) {
+            resourceSubTrees.push_back(castVector<WorkspaceObject>(subTree));
+          }
+        }
+      }
+      std::vector<WorkspaceObject> firstCopy = model.addAndInsertObjects(closure, resourceSubTrees);
+      if (firstCopy.size() < closure.size()) {
+        LOG_FREE(Error, "openstudio.model.Model", "Unable to clone objects into the target model.");
+        return result;
+      }
+      // drop the inserted resources
+      firstCopy.erase(firstCopy.begin() + closure.size(), firstCopy.end());
+      copies = firstCopy;
+      if (options.numberOfCopies > 1) {
+        std::vector<WorkspaceObject> otherCopies = model.addCopies(firstCopy, options.numberOfCopies - 1);
+        if (otherCopies.empty()) {
+          model.removeObjects(getHandles(firstCopy));
+          LOG_FREE(Error, "openstudio.model.Model", "Unable to clone objects into the target model.");
+          return result;
+        }
+        copies.insert(copies.end(), otherCopies.begin(), otherCopies.end());
+      }
+    }
+
+    if (copies.size() != closure.size() * options.numberOfCopies) {
+      LOG_FREE(Error, "openstudio.model.Model", "Unable to clone objects into the target model.");
+      return result;
+    }
+
+    result.reserve(objects.size() * options.numberOfCopies);
+    for (unsigned k = 0; k < options.numberOfCopies; ++k) {
+      for (unsigned i = 0; i < objects.size(); ++i) {
+        if (cloneOneByOne[i]) {
+          result.push_back(objects[i].clone(model));
+        } else {
+          result.push_back(copies[k * closure.size() + closureIndices[objects[i].handle()]].cast<ModelObject>());
+        }
+      }
+    }
+    return result;
+  }
+
   boost::optional<ComponentData> Model::insertComponent(const Component& component) {
     return getImpl<detail::Model_Impl>()->insertComponent(component);
   }
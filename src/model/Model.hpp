@@ -37,6 +37,9 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <typeindex>
 #include <vector>
 
 namespace openstudio {
@@ -69,6 +72,20 @@ namespace model {
     class ModelObject_Impl;
   }  // namespace detail
 
+  /** Options for Model::cloneMany. */
+  struct MODEL_API CloneOptions
+  {
+    /** Number of copies made of each object. */
+    unsigned numberOfCopies = 1;
+
+    /** Whether the recursive children of \link ParentObject ParentObjects \endlink are copied
+     *  along with their parents, as ParentObject::clone does. */
+    bool includeChildren = true;
+
+    /** Whether the LifeCycleCost and AdditionalProperties objects of copied objects are copied too. */
+    bool includeLifeCycleCostsAndAdditionalProperties = true;
+  };
+
   /** Model derives from Workspace and is a container for \link ModelObject ModelObjects
  *  \endlink as defined by the OpenStudio IDD. The OpenStudio Model is primarily a container for
  *  \link ModelObject ModelObjects \endlink which together define a complete or partial model of a
@@ -295,17 +312,39 @@ namespace model {
     template <typename T>
     std::vector<T> getModelObjects(bool sorted = false) const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> objects = this->objects(sorted);
-      result.reserve(objects.size());
-      for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
-        std::shared_ptr<typename T::ImplType> p = it->getImpl<typename T::ImplType>();
-        if (p) {
-          result.push_back(T(p));
+      std::vector<IddObjectType> types = this->iddObjectTypesOfFamily(
+        typeid(typename T::ImplType), [](const WorkspaceObject& object) { return static_cast<bool>(object.getImpl<typename T::ImplType>()); });
+      if (types.empty()) {
+        return result;
+      }
+      // every object of a type in the family is known to be a T::ImplType, so no dynamic cast is needed
+      if (sorted) {
+        std::vector<WorkspaceObject> objects = this->objects(true);
+        for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
+          if (std::binary_search(types.begin(), types.end(), it->iddObject().type())) {
+            result.push_back(T(std::static_pointer_cast<typename T::ImplType>(it->getImpl<openstudio::detail::IdfObject_Impl>())));
+          }
+        }
+        return result;
+      }
+      for (const IddObjectType& type : types) {
+        std::vector<WorkspaceObject> objects = this->getObjectsByType(type);
+        result.reserve(result.size() + objects.size());
+        for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
+          result.push_back(T(std::static_pointer_cast<typename T::ImplType>(it->getImpl<openstudio::detail::IdfObject_Impl>())));
         }
       }
       return result;
     }
 
+    /** Returns the IddObjectTypes present in this Model whose objects are instances of the
+   *  implementation class implType (e.g. typeid(detail::ParentObject_Impl)), in IddObjectType order.
+   *  The implementation class of a ModelObject is fixed by its IddObjectType, so isInstance is only
+   *  called on one representative object per type and the answer is remembered by the Model. This is
+   *  the index behind getModelObjects<T>(). */
+    std::vector<IddObjectType> iddObjectTypesOfFamily(const std::type_index& implType,
+                                                      const std::function<bool(const WorkspaceObject&)>& isInstance) const;
+
     /** Returns all \link ModelObject ModelObjects \endlink of type T, using T::iddObjectType() to
    *  speed up the search. This method will only work for concrete model objects (leaves in the
    *  ModelObject inheritance tree), hence the name. */
@@ -423,6 +462,22 @@ namespace model {
     /** Get all model objects. If sorted, then the objects are returned in the preferred order. */
     std::vector<ModelObject> modelObjects(bool sorted = false) const;
 
+    /** Clones objects into model options.numberOfCopies times, and returns the copies of objects one
+   *  copy after the other (result[k * objects.size() + i] is the k-th copy of objects[i]). The objects
+   *  must all be in the same model. For objects that only need themselves, per options their recursive
+   *  children, life cycle costs and additional properties copied, such as constructions, schedules and
+   *  space loads, this closure is computed once and every copy is added to model by a single
+   *  Workspace::addCopies call, with pointers within each copy remapped to that copy. Resources are
+   *  shared by all copies: if the objects are in another model, their resources are inserted into
+   *  model once, as clone does.
+   *
+   *  Objects that need a type-specific clone override, or whose children do (HVAC components, loops,
+   *  surfaces and sub surfaces with their convection coefficients, shading controls and foundations,
+   *  internal mass, and so spaces), are cloned one copy at a time with clone, children included.
+   *  Unique objects cannot be copied. Returns an empty vector on failure. */
+    static std::vector<ModelObject> cloneMany(const std::vector<ModelObject>& objects, Model& model,
+                                              const CloneOptions& options = CloneOptions());
+
     // DLM@20110614: looks like this is returning a ComponentData, not a primary object?
     /** Inserts Component into Model and returns the primary object, if possible. */
     boost::optional<ComponentData> insertComponent(const Component& component);
@@ -6,6 +6,9 @@
   %module openstudiomodelcore
 #endif
 
+// std::type_index and std::function are not wrapped, getModelObjects<T> is the C++ entry point
+%ignore openstudio::model::Model::iddObjectTypesOfFamily;
+
 %include <model/Model_Common_Include.i>
 
 #if defined SWIGRUBY
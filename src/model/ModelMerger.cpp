@@ -81,6 +81,7 @@
 
 #include <thread>
 
+#include <algorithm>
 #include <cmath>
 #include <tuple>
 
@@ -112,14 +113,14 @@ namespace model {
   std::map<UUID, UUID> ModelMerger::suggestHandleMapping(const Model& currentModel, const Model& newModel) const {
     std::map<UUID, UUID> result;
 
-    typedef std::set<UUID> HandleSet;
-    typedef std::map<std::string, UUID> StringHandleMap;
+    typedef std::unordered_set<UUID, boost::hash<boost::uuids::uuid>> HandleSet;
+    typedef std::unordered_map<std::string, UUID> StringHandleMap;
     typedef std::tuple<HandleSet, StringHandleMap, StringHandleMap> ObjectLookup;  // 0 - handle, 1 - CADObjectId, 2 - Name
     typedef std::map<IddObjectType, ObjectLookup> IddToObjectLookupMap;
 
     IddToObjectLookupMap currentIddToObjectLookupMap;
     for (const auto& iddObjectType : m_iddObjectTypesToMerge) {
-      ObjectLookup currentLookup;
+      ObjectLookup& currentLookup = currentIddToObjectLookupMap[iddObjectType];
       for (const auto& object : currentModel.getObjectsByType(iddObjectType)) {
         Handle handle = object.handle();
         std::get<0>(currentLookup).insert(handle);
@@ -137,11 +138,10 @@ namespace model {
 
         std::get<2>(currentLookup).insert(std::make_pair(object.nameString(), handle));
       }
-      currentIddToObjectLookupMap.insert(std::make_pair(iddObjectType, currentLookup));
     }
 
     for (const auto& iddObjectType : m_iddObjectTypesToMerge) {
-      ObjectLookup currentLookup = currentIddToObjectLookupMap[iddObjectType];
+      ObjectLookup& currentLookup = currentIddToObjectLookupMap[iddObjectType];
       for (const auto& object : newModel.getObjectsByType(iddObjectType)) {
         Handle handle = object.handle();
         if (std::get<0>(currentLookup).count(handle) > 0) {
@@ -166,20 +166,20 @@ namespace model {
           if (additionalProperties.hasFeature("CADObjectId")) {
             boost::optional<std::string> cadObjectId = additionalProperties.getFeatureAsString("CADObjectId");
             if (cadObjectId) {
-              if (std::get<1>(currentLookup).count(*cadObjectId) > 0) {
+              auto it = std::get<1>(currentLookup).find(*cadObjectId);
+              if (it != std::get<1>(currentLookup).end()) {
                 // cadObjectId is in both models
-                Handle currentHandle = std::get<1>(currentLookup)[*cadObjectId];
-                result[currentHandle] = handle;
+                result[it->second] = handle;
                 continue;
               }
             }
           }
         }
 
-        if (std::get<2>(currentLookup).count(object.nameString()) > 0) {
+        auto it = std::get<2>(currentLookup).find(object.nameString());
+        if (it != std::get<2>(currentLookup).end()) {
           // name is in both models
-          Handle currentHandle = std::get<2>(currentLookup)[object.nameString()];
-          result[currentHandle] = handle;
+          result[it->second] = handle;
           continue;
         }
       }
@@ -1003,7 +1003,8 @@ namespace model {
     m_newModel = newModel;
 
     m_newMergedHandles.clear();
-    m_currentToNewHandleMapping = handleMapping;
+    m_currentToNewHandleMapping.clear();
+    m_currentToNewHandleMapping.insert(handleMapping.begin(), handleMapping.end());
     m_newToCurrentHandleMapping.clear();
     for (const auto& it : handleMapping) {
       if (m_newToCurrentHandleMapping.find(it.second) != m_newToCurrentHandleMapping.end()) {
@@ -1027,6 +1028,9 @@ namespace model {
       }
     }
 
+    //** Skip objects that have not changed **//
+    skipUnchangedObjects();
+
     //** Merge objects from new model into current model **//
     for (const auto& iddObjectType : iddObjectTypesToMerge()) {
       for (auto& newObject : newModel.getObjectsByType(iddObjectType)) {
@@ -1035,6 +1039,120 @@ namespace model {
     }
   }
 
+  std::vector<ModelObject> ModelMerger::mergedSubtree(const ModelObject& object) const {
+    std::vector<ModelObject> result(1u, object);
+    if (boost::optional<Space> space = object.optionalCast<Space>()) {
+      for (const auto& surface : space->surfaces()) {
+        std::vector<ModelObject> children = getRecursiveChildren(surface);
+        result.insert(result.end(), children.begin(), children.end());
+      }
+      for (const auto& group : space->shadingSurfaceGroups()) {
+        std::vector<ModelObject> children = getRecursiveChildren(group);
+        result.insert(result.end(), children.begin(), children.end());
+      }
+      for (const auto& daylightingControl : space->daylightingControls()) {
+        result.push_back(daylightingControl);
+      }
+    } else if (boost::optional<ShadingSurfaceGroup> group = object.optionalCast<ShadingSurfaceGroup>()) {
+      std::vector<ModelObject> children = getRecursiveChildren(*group);
+      result.insert(result.end(), children.begin() + 1, children.end());
+    }
+
+    // window shading groups are reached through both the sub surface and the space
+    std::unordered_set<UUID, boost::hash<boost::uuids::uuid>> handles;
+    result.erase(std::remove_if(result.begin(), result.end(), [&handles](const ModelObject& member) { return !handles.insert(member.handle()).second; }),
+                 result.end());
+    return result;
+  }
+
+  std::size_t ModelMerger::fieldHash(const WorkspaceObject& object, bool inNewModel) const {
+    const std::unordered_map<UUID, UUID, boost::hash<boost::uuids::uuid>>& mapping = inNewModel ? m_newToCurrentHandleMapping : m_currentToNewHandleMapping;
+
+    std::size_t result = 0;
+    boost::hash_combine(result, object.iddObject().type().value());
+    unsigned start = object.iddObject().hasHandleField() ? 1u : 0u;
+    for (unsigned i = start, n = object.numFields(); i < n; ++i) {
+      boost::hash_combine(result, i);
+      if (boost::optional<WorkspaceObject> target = object.getTarget(i)) {
+        auto it = mapping.find(target->handle());
+        if (it != mapping.end()) {
+          boost::hash_combine(result, inNewModel ? it->second : target->handle());
+        } else {
+          boost::hash_combine(result, target->iddObject().type().value());
+          boost::hash_combine(result, target->nameString());
+        }
+      } else if (boost::optional<std::string> value = object.getString(i)) {
+        boost::hash_combine(result, *value);
+      }
+    }
+
+    // mergeSpace also carries over the thermal zone's use of its daylighting controls
+    if (boost::optional<DaylightingControl> daylightingControl = object.optionalCast<DaylightingControl>()) {
+      for (const auto& thermalZone : daylightingControl->getModelObjectSources<ThermalZone>()) {
+        boost::hash_combine(result, fieldHash(thermalZone, inNewModel));
+      }
+    }
+
+    return result;
+  }
+
+  void ModelMerger::skipUnchangedObjects() {
+    typedef std::vector<std::pair<std::size_t, UUID>> HashHandleVector;
+    auto subtreeHashes = [this](const ModelObject& object, bool inNewModel) {
+      HashHandleVector result;
+      for (const auto& member : mergedSubtree(object)) {
+        result.push_back(std::make_pair(fieldHash(member, inNewModel), member.handle()));
+      }
+      // the merged object stays in front, the rest is paired up by hash
+      std::sort(result.begin() + 1, result.end());
+      return result;
+    };
+
+    // decide on all objects before recording any new mappings, so that the hashes do not depend on the order
+    std::vector<std::pair<UUID, UUID>> unchanged;  // current, new
+    for (const auto& iddObjectType : {IddObjectType(IddObjectType::OS_Space), IddObjectType(IddObjectType::OS_ShadingSurfaceGroup)}) {
+      for (const auto& newWorkspaceObject : m_newModel.getObjectsByType(iddObjectType)) {
+        ModelObject newObject = newWorkspaceObject.cast<ModelObject>();
+        if (boost::optional<ShadingSurfaceGroup> newGroup = newObject.optionalCast<ShadingSurfaceGroup>()) {
+          if (newGroup->space()) {
+            // merged along with its space
+            continue;
+          }
+        }
+        boost::optional<UUID> currentHandle = getCurrentModelHandle(newObject.handle());
+        if (!currentHandle) {
+          continue;
+        }
+        boost::optional<ModelObject> currentObject = m_currentModel.getModelObject<ModelObject>(*currentHandle);
+        if (!currentObject || (currentObject->iddObject().type() != iddObjectType)) {
+          continue;
+        }
+        if (boost::optional<ShadingSurfaceGroup> currentGroup = currentObject->optionalCast<ShadingSurfaceGroup>()) {
+          if (currentGroup->space()) {
+            continue;
+          }
+        }
+
+        HashHandleVector currentHashes = subtreeHashes(*currentObject, false);
+        HashHandleVector newHashes = subtreeHashes(newObject, true);
+        if ((currentHashes.size() != newHashes.size())
+            || !std::equal(currentHashes.begin(), currentHashes.end(), newHashes.begin(),
+                           [](const std::pair<std::size_t, UUID>& a, const std::pair<std::size_t, UUID>& b) { return a.first == b.first; })) {
+          continue;
+        }
+        for (unsigned i = 0, n = currentHashes.size(); i < n; ++i) {
+          unchanged.push_back(std::make_pair(currentHashes[i].second, newHashes[i].second));
+        }
+      }
+    }
+
+    for (const auto& pair : unchanged) {
+      m_newMergedHandles.insert(pair.second);
+      m_currentToNewHandleMapping[pair.first] = pair.second;
+      m_newToCurrentHandleMapping[pair.second] = pair.first;
+    }
+  }
+
   std::vector<IddObjectType> ModelMerger::iddObjectTypesToMerge() const {
     return m_iddObjectTypesToMerge;
   }
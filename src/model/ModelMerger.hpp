@@ -36,7 +36,11 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <boost/functional/hash.hpp>
+
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 namespace model {
@@ -102,14 +106,26 @@ namespace model {
 
     boost::optional<WorkspaceObject> getCurrentModelObject(const WorkspaceObject& newObject);
 
+    // Objects whose contents are replaced wholesale by their merge function, i.e. the object and the surfaces, shading
+    // surface groups and daylighting controls that mergeSpace or mergeShadingSurfaceGroup remove and re-clone
+    std::vector<ModelObject> mergedSubtree(const ModelObject& object) const;
+
+    // Hash of the fields of object that can be compared across models: pointers to mapped objects hash as the
+    // current model handle, other pointers as the target's type and name
+    std::size_t fieldHash(const WorkspaceObject& object, bool inNewModel) const;
+
+    // Marks mapped spaces and shading surface groups whose subtrees hash the same in both models as merged, and
+    // maps their subtree objects, so that they are skipped instead of being rebuilt
+    void skipUnchangedObjects();
+
     StringStreamLogSink m_logSink;
 
     Model m_currentModel;
     Model m_newModel;
-    std::set<UUID> m_newMergedHandles;
+    std::unordered_set<UUID, boost::hash<boost::uuids::uuid>> m_newMergedHandles;
     std::vector<IddObjectType> m_iddObjectTypesToMerge;
-    std::map<UUID, UUID> m_currentToNewHandleMapping;
-    std::map<UUID, UUID> m_newToCurrentHandleMapping;
+    std::unordered_map<UUID, UUID, boost::hash<boost::uuids::uuid>> m_currentToNewHandleMapping;
+    std::unordered_map<UUID, UUID, boost::hash<boost::uuids::uuid>> m_newToCurrentHandleMapping;
   };
 
 }  // namespace model
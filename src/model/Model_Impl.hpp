@@ -51,6 +51,10 @@
 
 #include <boost/optional.hpp>
 
+#include <functional>
+#include <map>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -137,6 +141,11 @@ namespace model {
       /// Get the sql file
       boost::optional<openstudio::SqlFile> sqlFile() const;
 
+      /** Returns the IddObjectTypes present in this Model whose objects are instances of implType. The
+     *  verdict for each (implType, IddObjectType) pair is computed once from a representative object. */
+      std::vector<IddObjectType> iddObjectTypesOfFamily(const std::type_index& implType,
+                                                        const std::function<bool(const WorkspaceObject&)>& isInstance) const;
+
       /** Get the Building object if there is one, this implementation uses a cached reference to the Building
      *  object which can be significantly faster than calling getOptionalUniqueModelObject<Building>(). */
       boost::optional<Building> building() const;
@@ -309,6 +318,9 @@ namespace model {
       mutable boost::optional<YearDescription> m_cachedYearDescription;
       mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+      // implementation class -> whether objects of each IddObjectType seen so far belong to it
+      mutable std::unordered_map<std::type_index, std::map<IddObjectType, bool>> m_typeFamilies;
+
       // private slots:
       void clearCachedData();
       void clearCachedBuilding(const Handle& handle);
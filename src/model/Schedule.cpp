@@ -35,10 +35,13 @@
 #include "ScheduleTypeRegistry.hpp"
 #include "ScheduleDay.hpp"
 #include "ScheduleDay_Impl.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
 
 #include "../utilities/idf/ValidityReport.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/time/Date.hpp"
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -55,12 +58,79 @@ namespace model {
   namespace detail {
 
     // constructor
-    Schedule_Impl::Schedule_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle) : ScheduleBase_Impl(idfObject, model, keepHandle) {}
+    Schedule_Impl::Schedule_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle) : ScheduleBase_Impl(idfObject, model, keepHandle) {
+      // connect signals
+      this->Schedule_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearAnnualValuesCache>(this);
+    }
 
     Schedule_Impl::Schedule_Impl(const openstudio::detail::WorkspaceObject_Impl& other, Model_Impl* model, bool keepHandle)
-      : ScheduleBase_Impl(other, model, keepHandle) {}
+      : ScheduleBase_Impl(other, model, keepHandle) {
+      // connect signals
+      this->Schedule_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearAnnualValuesCache>(this);
+    }
+
+    Schedule_Impl::Schedule_Impl(const Schedule_Impl& other, Model_Impl* model, bool keepHandles) : ScheduleBase_Impl(other, model, keepHandles) {
+      // connect signals
+      this->Schedule_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearAnnualValuesCache>(this);
+    }
+
+    const std::vector<double>& Schedule_Impl::annualValues(int timestepsPerHour, int year) const {
+      std::pair<int, int> key(timestepsPerHour, year);
+      auto it = m_annualValues.find(key);
+      if (it == m_annualValues.end()) {
+        std::vector<double> values;
+        if ((timestepsPerHour <= 0) || (60 % timestepsPerHour != 0)) {
+          LOG(Error, "Number of timesteps per hour " << timestepsPerHour << " does not evenly divide 60.");
+        } else {
+          values = compileAnnualValues(timestepsPerHour, year);
+        }
+        it = m_annualValues.insert(std::make_pair(key, std::move(values))).first;
+      }
+      return it->second;
+    }
+
+    std::vector<double> Schedule_Impl::compileAnnualValues(int /*timestepsPerHour*/, int /*year*/) const {
+      LOG(Warn, "Annual values are not available for " << briefDescription() << ".");
+      return std::vector<double>();
+    }
+
+    void Schedule_Impl::addAnnualValuesDependency(const ModelObject& dependency) const {
+      if (dependency.handle() == this->handle()) {
+        return;
+      }
+      if (!m_annualValuesDependencies.insert(dependency.handle()).second) {
+        // already connected
+        return;
+      }
 
-    Schedule_Impl::Schedule_Impl(const Schedule_Impl& other, Model_Impl* model, bool keepHandles) : ScheduleBase_Impl(other, model, keepHandles) {}
+      // connections are released automatically if either object is destroyed
+      auto self = const_cast<Schedule_Impl*>(this);
+      std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = dependency.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+      impl.get()->openstudio::detail::WorkspaceObject_Impl::onChange.connect<Schedule_Impl, &Schedule_Impl::clearAnnualValuesCache>(self);
+      impl.get()->openstudio::detail::WorkspaceObject_Impl::onRemoveFromWorkspace.connect<Schedule_Impl, &Schedule_Impl::annualValuesDependencyRemoved>(
+        self);
+    }
+
+    void Schedule_Impl::clearAnnualValuesCache() {
+      m_annualValues.clear();
+    }
+
+    void Schedule_Impl::annualValuesDependencyRemoved(const Handle& handle) {
+      m_annualValuesDependencies.erase(handle);
+      clearAnnualValuesCache();
+    }
+
+    std::vector<Schedule_Impl::AnnualDay> Schedule_Impl::annualDays(int year) {
+      std::vector<AnnualDay> result;
+      unsigned numDays = Date::isLeapYear(year) ? 366 : 365;
+      result.reserve(numDays);
+      Date date(MonthOfYear::Jan, 1, year);
+      for (unsigned i = 0; i < numDays; ++i) {
+        result.push_back(AnnualDay{openstudio::month(date.monthOfYear()), date.dayOfMonth(), date.dayOfWeek().value()});
+        date += Time(1);
+      }
+      return result;
+    }
 
     bool Schedule_Impl::candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const {
       ModelObjectVector users = getObject<Schedule>().getModelObjectSources<ModelObject>();
@@ -97,6 +167,18 @@ namespace model {
     OS_ASSERT(getImpl<detail::Schedule_Impl>());
   }
 
+  std::vector<double> Schedule::annualValues(int timestepsPerHour, int year) const {
+    return getImpl<detail::Schedule_Impl>()->annualValues(timestepsPerHour, year);
+  }
+
+  std::vector<double> Schedule::annualValues(int timestepsPerHour) const {
+    int year = openstudio::YearDescription().assumedYear();
+    if (boost::optional<YearDescription> yearDescription = this->model().yearDescription()) {
+      year = yearDescription->assumedYear();
+    }
+    return annualValues(timestepsPerHour, year);
+  }
+
   // constructor from impl
   Schedule::Schedule(std::shared_ptr<detail::Schedule_Impl> impl) : ScheduleBase(std::move(impl)) {
     OS_ASSERT(getImpl<detail::Schedule_Impl>());
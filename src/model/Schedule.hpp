@@ -63,6 +63,20 @@ namespace model {
 
     virtual ~Schedule() {}
 
+    //@}
+    /** @name Getters */
+    //@{
+
+    /** Returns the value of this schedule at the end of every timestep of year, in chronological order, that is
+     *  8760 * timestepsPerHour values (8784 * timestepsPerHour in a leap year). Values are compiled once and cached
+     *  until this schedule, or any object it is built from, changes. Holidays, design days and daylight saving time
+     *  are not applied. Returns an empty vector if timestepsPerHour does not evenly divide 60 or if this type of
+     *  schedule cannot be evaluated. */
+    std::vector<double> annualValues(int timestepsPerHour, int year) const;
+
+    /** Same as annualValues(timestepsPerHour, year), using the assumed year of the model's YearDescription. */
+    std::vector<double> annualValues(int timestepsPerHour) const;
+
     //@}
    protected:
     /// @cond
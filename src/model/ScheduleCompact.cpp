@@ -33,6 +33,7 @@
 
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
+#include "ScheduleDay_Impl.hpp"
 
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 
@@ -40,6 +41,10 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/Time.hpp"
+
+#include <boost/algorithm/string.hpp>
 
 using openstudio::Handle;
 using openstudio::OptionalHandle;
@@ -179,6 +184,137 @@ namespace model {
       return boost::none;
     }
 
+    std::vector<double> ScheduleCompact_Impl::compileAnnualValues(int timestepsPerHour, int year) const {
+      struct DayProfile
+      {
+        std::vector<std::string> dayTypes;
+        bool interpolate = false;
+        std::vector<openstudio::Time> times;
+        std::vector<double> values;
+      };
+
+      struct Period
+      {
+        unsigned throughKey = 0;
+        std::vector<DayProfile> dayProfiles;
+      };
+
+      // parse the Through: / For: / Interpolate: / Until: fields
+      std::vector<Period> periods;
+      boost::optional<openstudio::Time> untilTime;
+      for (const IdfExtensibleGroup& eg : extensibleGroups()) {
+        std::string str = eg.getString(0, true).get();
+        boost::trim(str);
+        boost::to_lower(str);
+        if (str.empty()) {
+          continue;
+        }
+
+        std::string::size_type colon = str.find(':');
+        std::string keyword = str.substr(0, colon);
+        std::string argument = (colon == std::string::npos) ? std::string() : boost::trim_copy(str.substr(colon + 1));
+        try {
+          if (keyword == "through") {
+            std::vector<std::string> monthDay;
+            boost::split(monthDay, argument, boost::is_any_of("/"));
+            if (monthDay.size() != 2u) {
+              throw std::runtime_error("Cannot parse '" + str + "'");
+            }
+            Period period;
+            period.throughKey =
+              100 * boost::lexical_cast<unsigned>(boost::trim_copy(monthDay[0])) + boost::lexical_cast<unsigned>(boost::trim_copy(monthDay[1]));
+            periods.push_back(period);
+          } else if (keyword == "for") {
+            if (periods.empty()) {
+              throw std::runtime_error("'" + str + "' is not preceded by a Through: field");
+            }
+            DayProfile dayProfile;
+            boost::split(dayProfile.dayTypes, argument, boost::is_any_of(" ,"), boost::token_compress_on);
+            periods.back().dayProfiles.push_back(dayProfile);
+          } else if (keyword == "interpolate") {
+            if (periods.empty() || periods.back().dayProfiles.empty()) {
+              throw std::runtime_error("'" + str + "' is not preceded by a For: field");
+            }
+            // Average and Linear are both approximated by linear interpolation
+            periods.back().dayProfiles.back().interpolate = (argument != "no");
+          } else if (keyword == "until") {
+            std::vector<std::string> hourMinute;
+            boost::split(hourMinute, argument, boost::is_any_of(":"));
+            if (hourMinute.size() != 2u) {
+              throw std::runtime_error("Cannot parse '" + str + "'");
+            }
+            untilTime = openstudio::Time(0, boost::lexical_cast<int>(boost::trim_copy(hourMinute[0])),
+                                         boost::lexical_cast<int>(boost::trim_copy(hourMinute[1])));
+          } else {
+            double value = boost::lexical_cast<double>(str);
+            if (!untilTime || periods.empty() || periods.back().dayProfiles.empty()) {
+              throw std::runtime_error("Value '" + str + "' is not preceded by an Until: field");
+            }
+            periods.back().dayProfiles.back().times.push_back(*untilTime);
+            periods.back().dayProfiles.back().values.push_back(value);
+            untilTime.reset();
+          }
+        } catch (const std::exception& e) {
+          LOG(Error, "Cannot compute annual values for " << briefDescription() << ": " << e.what());
+          return std::vector<double>();
+        }
+      }
+
+      static const std::vector<std::string> dayNames{"sunday", "monday", "tuesday", "wednesday", "thursday", "friday", "saturday"};
+      auto appliesOn = [](const DayProfile& dayProfile, int dayOfWeek) {
+        bool weekend = ((dayOfWeek == DayOfWeek::Sunday) || (dayOfWeek == DayOfWeek::Saturday));
+        for (const std::string& dayType : dayProfile.dayTypes) {
+          if ((dayType == "alldays") || (dayType == "allotherdays") || (dayType == dayNames[dayOfWeek]) || (dayType == "weekdays" && !weekend)
+              || (dayType == "weekends" && weekend)) {
+            return true;
+          }
+        }
+        return false;
+      };
+
+      // sample each day profile once, the first matching For: field in a period wins
+      std::vector<std::vector<std::vector<double>>> periodValues;
+      std::vector<std::vector<int>> periodProfileIndices;
+      for (const Period& period : periods) {
+        std::vector<std::vector<double>> profileValues;
+        for (const DayProfile& dayProfile : period.dayProfiles) {
+          profileValues.push_back(ScheduleDay_Impl::timestepValues(dayProfile.times, dayProfile.values, dayProfile.interpolate, timestepsPerHour));
+        }
+        std::vector<int> profileIndices(7, -1);
+        for (int dayOfWeek = 0; dayOfWeek < 7; ++dayOfWeek) {
+          for (unsigned i = 0; i < period.dayProfiles.size(); ++i) {
+            if (appliesOn(period.dayProfiles[i], dayOfWeek)) {
+              profileIndices[dayOfWeek] = i;
+              break;
+            }
+          }
+        }
+        periodValues.push_back(profileValues);
+        periodProfileIndices.push_back(profileIndices);
+      }
+
+      std::vector<AnnualDay> days = annualDays(year);
+      unsigned numTimestepsPerDay = 24 * timestepsPerHour;
+      std::vector<double> result(days.size() * numTimestepsPerDay, 0.0);
+      unsigned p = 0;
+      for (unsigned j = 0; j < days.size(); ++j) {
+        unsigned key = 100 * days[j].month + days[j].dayOfMonth;
+        while ((p < periods.size()) && (periods[p].throughKey < key)) {
+          ++p;
+        }
+        if (p == periods.size()) {
+          break;
+        }
+        int index = periodProfileIndices[p][days[j].dayOfWeek];
+        if (index >= 0) {
+          const std::vector<double>& values = periodValues[p][index];
+          std::copy(values.begin(), values.end(), result.begin() + j * numTimestepsPerDay);
+        }
+      }
+
+      return result;
+    }
+
     std::vector<EMSActuatorNames> ScheduleCompact_Impl::emsActuatorNames() const {
       std::vector<EMSActuatorNames> actuators{{"Schedule:Compact", "Schedule Value"}};
       return actuators;
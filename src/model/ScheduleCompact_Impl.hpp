@@ -99,6 +99,9 @@ namespace model {
       boost::optional<double> constantValue() const;
 
       //@}
+     protected:
+      virtual std::vector<double> compileAnnualValues(int timestepsPerHour, int year) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleCompact");
     };
@@ -105,6 +105,10 @@ namespace model {
       return *result;
     }
 
+    std::vector<double> ScheduleConstant_Impl::compileAnnualValues(int timestepsPerHour, int year) const {
+      return std::vector<double>(annualDays(year).size() * 24 * timestepsPerHour, value());
+    }
+
     bool ScheduleConstant_Impl::setScheduleTypeLimits(const ScheduleTypeLimits& scheduleTypeLimits) {
       if (scheduleTypeLimits.model() != model()) {
         return false;
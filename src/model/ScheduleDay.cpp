@@ -51,6 +51,8 @@
 #include "../utilities/time/Time.hpp"
 #include "../utilities/data/Vector.hpp"
 
+#include <cmath>
+
 namespace openstudio {
 namespace model {
 
@@ -236,6 +238,64 @@ namespace model {
       return result;
     }
 
+    std::vector<double> ScheduleDay_Impl::timestepValues(int timestepsPerHour) const {
+      return timestepValues(this->times(), this->values(), this->interpolatetoTimestep(), timestepsPerHour);
+    }
+
+    std::vector<double> ScheduleDay_Impl::timestepValues(const std::vector<openstudio::Time>& times, const std::vector<double>& values,
+                                                         bool interpolatetoTimestep, int timestepsPerHour) {
+      std::vector<double> result;
+      if ((timestepsPerHour <= 0) || (60 % timestepsPerHour != 0)) {
+        LOG(Error, "Number of timesteps per hour " << timestepsPerHour << " does not evenly divide 60.");
+        return result;
+      }
+
+      unsigned N = times.size();
+      OS_ASSERT(values.size() == N);
+
+      unsigned numTimesteps = 24 * timestepsPerHour;
+      result.resize(numTimesteps, 0.0);
+      if (N == 0) {
+        return result;
+      }
+
+      // same bounds as getValue, working in minutes to avoid round off on exact matches
+      const double tol = 1.0e-6;
+      const double minutesPerTimestep = 60.0 / timestepsPerHour;
+      std::vector<double> minutes(N);
+      for (unsigned i = 0; i < N; ++i) {
+        minutes[i] = times[i].totalMinutes();
+      }
+
+      // times are sorted, so walk them once alongside the timesteps
+      unsigned j = 0;
+      for (unsigned k = 0; k < numTimesteps; ++k) {
+        double t = (k + 1) * minutesPerTimestep;
+        while ((j < N) && (minutes[j] < t - tol)) {
+          ++j;
+        }
+
+        if (j == N) {
+          // past the last until time
+          if (interpolatetoTimestep) {
+            double x0 = minutes[N - 1];
+            double x1 = 1440.0 + 1.44e-3;
+            result[k] = values[N - 1] * (x1 - t) / (x1 - x0);
+          }
+        } else if (!interpolatetoTimestep || (std::abs(minutes[j] - t) <= tol)) {
+          result[k] = values[j];
+        } else {
+          double x0 = (j == 0) ? -1.44e-3 : minutes[j - 1];
+          double y0 = (j == 0) ? 0.0 : values[j - 1];
+          double x1 = minutes[j];
+          double y1 = values[j];
+          result[k] = y0 + (y1 - y0) * (t - x0) / (x1 - x0);
+        }
+      }
+
+      return result;
+    }
+
     bool ScheduleDay_Impl::setScheduleTypeLimits(const ScheduleTypeLimits& scheduleTypeLimits) {
       if (scheduleTypeLimits.model() != model()) {
         return false;
@@ -438,6 +498,10 @@ namespace model {
     return getImpl<detail::ScheduleDay_Impl>()->getValue(time);
   }
 
+  std::vector<double> ScheduleDay::timestepValues(int timestepsPerHour) const {
+    return getImpl<detail::ScheduleDay_Impl>()->timestepValues(timestepsPerHour);
+  }
+
   bool ScheduleDay::setInterpolatetoTimestep(bool interpolatetoTimestep) {
     return getImpl<detail::ScheduleDay_Impl>()->setInterpolatetoTimestep(interpolatetoTimestep);
   }
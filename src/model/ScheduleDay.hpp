@@ -88,6 +88,11 @@ namespace model {
     /// Returns the value in effect at the given time.  If time is less than 0 days or greater than 1 day, 0 is returned.
     double getValue(const openstudio::Time& time) const;
 
+    /// Returns the value in effect at the end of each timestep of the day, 24 * timestepsPerHour values in total.
+    /// Equivalent to calling getValue at the end of each timestep, but computed in a single pass.
+    /// Returns an empty vector if timestepsPerHour does not evenly divide 60.
+    std::vector<double> timestepValues(int timestepsPerHour) const;
+
     //@}
     /** @name Setters */
     //@{
@@ -96,6 +96,14 @@ namespace model {
       /// Returns the value in effect at the given time.  If time is less than 0 days or greater than 1 day, 0 is returned.
       double getValue(const openstudio::Time& time) const;
 
+      /// Returns the value in effect at the end of each timestep of the day, 24 * timestepsPerHour values in total.
+      std::vector<double> timestepValues(int timestepsPerHour) const;
+
+      /// Samples the day described by times (as returned by times()) and values at the end of each timestep,
+      /// with the same semantics as getValue. Shared with other schedules that embed day profiles.
+      static std::vector<double> timestepValues(const std::vector<openstudio::Time>& times, const std::vector<double>& values,
+                                                bool interpolatetoTimestep, int timestepsPerHour);
+
       //@}
       /** @name Setters */
       //@{
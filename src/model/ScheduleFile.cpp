@@ -272,25 +272,35 @@ namespace model {
   }
   */
 
-    openstudio::TimeSeries ScheduleFile_Impl::timeSeries() const {
-      openstudio::TimeSeries result;
-      /* FIXME!
-    Date startDate(openstudio::MonthOfYear(this->startMonth()), this->startDay());
-    Time intervalLength(0, 0, this->intervalLength());
-    Vector values(this->numExtensibleGroups());
-    unsigned i = 0;
-    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups())) {
-      OptionalDouble x = group.getDouble(0);
-      OS_ASSERT(x);
-      values[i] = *x;
-      ++i;
-    }
-    TimeSeries result(startDate, intervalLength, values, "");
-    result.setOutOfRangeValue(this->outOfRangeValue());
-    */
+    std::vector<double> ScheduleFile_Impl::values() const {
+      char separator = columnSeparatorChar();
+      if (separator == '\0') {
+        LOG(Error, "Invalid column separator '" << columnSeparator() << "' for " << briefDescription());
+        return std::vector<double>();
+      }
+
+      std::vector<double> result =
+        CSVFile::readColumnAsDoubleVector(externalFile().filePath(), columnNumber() - 1, rowstoSkipatTop(), separator);
+
+      // only the requested number of hours is used
+      unsigned numItems = numberofHoursofData() * 60 / minutesperItem();
+      if (result.size() > numItems) {
+        result.resize(numItems);
+      }
       return result;
     }
 
+    openstudio::TimeSeries ScheduleFile_Impl::timeSeries() const {
+      std::vector<double> values = this->values();
+      if (values.empty()) {
+        return openstudio::TimeSeries();
+      }
+      // data starts at 00:00 on January 1st
+      Date startDate(MonthOfYear::Jan, 1);
+      Time intervalLength(0, 0, minutesperItem());
+      return openstudio::TimeSeries(startDate, intervalLength, createVector(values), "");
+    }
+
     bool ScheduleFile_Impl::setTimeSeries(const openstudio::TimeSeries& timeSeries) {
       /* FIXME!
     // check the interval
@@ -446,6 +456,10 @@ namespace model {
     return getImpl<detail::ScheduleFile_Impl>()->csvFile();
   }
 
+  std::vector<double> ScheduleFile::values() const {
+    return getImpl<detail::ScheduleFile_Impl>()->values();
+  }
+
   /* FIXME!
 openstudio::TimeSeries ScheduleFile::timeSeries(unsigned columnIndex) const {
   return getImpl<detail::ScheduleFile_Impl>()->timeSeries(columnIndex);
@@ -95,6 +95,11 @@ namespace model {
 
     bool isMinutesperItemDefaulted() const;
 
+    /** Returns the values of columnNumber(), read directly from the external file while honoring rowstoSkipatTop(),
+     *  columnSeparator() and numberofHoursofData(). Only the requested column is parsed. Returns an empty vector if the
+     *  file cannot be read or the column contains non numeric values. */
+    std::vector<double> values() const;
+
     /* FIXME! openstudio::TimeSeries timeSeries(unsigned columnIndex) const;*/
 
     boost::optional<CSVFile> csvFile() const;
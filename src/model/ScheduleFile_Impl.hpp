@@ -102,6 +102,8 @@ namespace model {
 
       bool isMinutesperItemDefaulted() const;
 
+      virtual std::vector<double> values() const override;
+
       virtual openstudio::TimeSeries timeSeries() const override;
 
       /* FIXME! openstudio::TimeSeries timeSeries(unsigned columnIndex) const; */
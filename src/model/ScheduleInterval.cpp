@@ -43,6 +43,7 @@
 #include <utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
 
 #include "../utilities/data/TimeSeries.hpp"
+#include "../utilities/time/DateTime.hpp"
 #include "../utilities/core/Assert.hpp"
 
 using openstudio::Handle;
@@ -89,6 +90,45 @@ namespace model {
       return toStandardVector(timeSeries().values());
     }
 
+    std::vector<double> ScheduleInterval_Impl::compileAnnualValues(int timestepsPerHour, int year) const {
+      openstudio::TimeSeries timeSeries = this->timeSeries();
+      std::vector<long> secondsFromFirstReport = timeSeries.secondsFromFirstReport();
+      openstudio::Vector values = timeSeries.values();
+      double outOfRangeValue = timeSeries.outOfRangeValue();
+
+      unsigned numTimesteps = annualDays(year).size() * 24 * timestepsPerHour;
+      std::vector<double> result(numTimesteps, outOfRangeValue);
+      if (secondsFromFirstReport.empty()) {
+        return result;
+      }
+
+      // position of the first report within its own year, the time series is laid over year by month and day
+      openstudio::DateTime firstReportDateTime = timeSeries.firstReportDateTime();
+      long offset = 86400 * (long(firstReportDateTime.date().dayOfYear()) - 1) + firstReportDateTime.time().totalSeconds();
+
+      // start of the first reporting interval, relative to the first report
+      long start = -firstReportDateTime.time().totalSeconds();
+      if (boost::optional<openstudio::Time> intervalLength = timeSeries.intervalLength()) {
+        start = -intervalLength->totalSeconds();
+      }
+
+      // same semantics as TimeSeries::value, values hold over the interval ending at their report time
+      long secondsPerTimestep = 3600 / timestepsPerHour;
+      unsigned i = 0;
+      for (unsigned k = 0; k < numTimesteps; ++k) {
+        long t = (k + 1) * secondsPerTimestep - offset;
+        if ((t <= start) || (t > secondsFromFirstReport.back())) {
+          continue;
+        }
+        while (secondsFromFirstReport[i] < t) {
+          ++i;
+        }
+        result[k] = values[i];
+      }
+
+      return result;
+    }
+
   }  // namespace detail
 
   boost::optional<ScheduleInterval> ScheduleInterval::fromTimeSeries(const openstudio::TimeSeries& timeSeries, Model& model) {
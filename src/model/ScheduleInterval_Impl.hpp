@@ -85,6 +85,9 @@ namespace model {
       virtual bool setTimeSeries(const openstudio::TimeSeries& timeSeries) = 0;
 
       //@}
+     protected:
+      virtual std::vector<double> compileAnnualValues(int timestepsPerHour, int year) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleInterval");
     };
@@ -46,8 +46,11 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
 #include "../utilities/time/Date.hpp"
 
+#include <set>
+
 namespace openstudio {
 namespace model {
 
@@ -412,6 +415,9 @@ namespace model {
     }
 
     bool ScheduleRuleset_Impl::setScheduleRuleIndex(ScheduleRule& scheduleRule, unsigned index) {
+      // called when rules are added or reordered
+      clearAnnualValuesCache();
+
       std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
       unsigned N = scheduleRules.size();
 
@@ -469,6 +475,77 @@ namespace model {
       return true;
     }
 
+    std::vector<double> ScheduleRuleset_Impl::compileAnnualValues(int timestepsPerHour, int year) const {
+      std::vector<AnnualDay> days = annualDays(year);
+      unsigned numDays = days.size();
+      unsigned numTimestepsPerDay = 24 * timestepsPerHour;
+
+      // sample each distinct day schedule once, active rule is the first matching rule
+      ScheduleDay defaultDaySchedule = this->defaultDaySchedule();
+      addAnnualValuesDependency(defaultDaySchedule);
+      std::vector<double> defaultValues = defaultDaySchedule.timestepValues(timestepsPerHour);
+
+      std::vector<const std::vector<double>*> dayValues(numDays, &defaultValues);
+      std::vector<bool> assigned(numDays, false);
+
+      std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
+      std::vector<std::vector<double>> ruleValues(scheduleRules.size());
+      for (unsigned i = 0; i < scheduleRules.size(); ++i) {
+        const ScheduleRule& scheduleRule = scheduleRules[i];
+        addAnnualValuesDependency(scheduleRule);
+        ScheduleDay daySchedule = scheduleRule.daySchedule();
+        addAnnualValuesDependency(daySchedule);
+        ruleValues[i] = daySchedule.timestepValues(timestepsPerHour);
+
+        // compare on month and day only since rule dates carry the model's assumed year
+        std::vector<bool> appliesOnDay{scheduleRule.applySunday(),   scheduleRule.applyMonday(), scheduleRule.applyTuesday(),
+                                       scheduleRule.applyWednesday(), scheduleRule.applyThursday(), scheduleRule.applyFriday(),
+                                       scheduleRule.applySaturday()};
+        std::set<unsigned> specificDays;
+        unsigned startKey = 0;
+        unsigned endKey = 0;
+        bool dateRange = istringEqual("DateRange", scheduleRule.dateSpecificationType());
+        if (dateRange) {
+          boost::optional<openstudio::Date> startDate = scheduleRule.startDate();
+          boost::optional<openstudio::Date> endDate = scheduleRule.endDate();
+          OS_ASSERT(startDate);
+          OS_ASSERT(endDate);
+          startKey = 100 * openstudio::month(startDate->monthOfYear()) + startDate->dayOfMonth();
+          endKey = 100 * openstudio::month(endDate->monthOfYear()) + endDate->dayOfMonth();
+        } else {
+          for (const openstudio::Date& specificDate : scheduleRule.specificDates()) {
+            specificDays.insert(100 * openstudio::month(specificDate.monthOfYear()) + specificDate.dayOfMonth());
+          }
+        }
+
+        for (unsigned j = 0; j < numDays; ++j) {
+          if (assigned[j] || !appliesOnDay[days[j].dayOfWeek]) {
+            continue;
+          }
+          unsigned key = 100 * days[j].month + days[j].dayOfMonth;
+          bool contains = false;
+          if (!dateRange) {
+            contains = (specificDays.find(key) != specificDays.end());
+          } else if (startKey <= endKey) {
+            contains = ((key >= startKey) && (key <= endKey));
+          } else {
+            contains = ((key >= startKey) || (key <= endKey));
+          }
+          if (contains) {
+            dayValues[j] = &ruleValues[i];
+            assigned[j] = true;
+          }
+        }
+      }
+
+      std::vector<double> result;
+      result.reserve(numDays * numTimestepsPerDay);
+      for (const std::vector<double>* values : dayValues) {
+        result.insert(result.end(), values->begin(), values->end());
+      }
+      return result;
+    }
+
     std::vector<int> ScheduleRuleset_Impl::getActiveRuleIndices(const openstudio::Date& startDate, const openstudio::Date& endDate) const {
 
       // need to check or adjust assumed base year on input date?
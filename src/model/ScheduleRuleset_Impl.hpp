@@ -156,6 +156,9 @@ namespace model {
       virtual void ensureNoLeapDays() override;
 
       //@}
+     protected:
+      virtual std::vector<double> compileAnnualValues(int timestepsPerHour, int year) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleRuleset");
 
@@ -31,6 +31,8 @@
 #include "ScheduleYear_Impl.hpp"
 #include "ScheduleWeek.hpp"
 #include "ScheduleWeek_Impl.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleDay_Impl.hpp"
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
 #include "YearDescription.hpp"
@@ -45,6 +47,8 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/time/Date.hpp"
 
+#include <map>
+
 namespace openstudio {
 namespace model {
 
@@ -135,6 +139,53 @@ namespace model {
       return result;
     }
 
+    std::vector<double> ScheduleYear_Impl::compileAnnualValues(int timestepsPerHour, int year) const {
+      std::vector<AnnualDay> days = annualDays(year);
+      unsigned numTimestepsPerDay = 24 * timestepsPerHour;
+      std::vector<double> result(days.size() * numTimestepsPerDay, 0.0);
+
+      // sample each distinct day schedule once
+      std::map<Handle, std::vector<double>> dayValues;
+      auto sampleDay = [&](const boost::optional<ScheduleDay>& daySchedule) -> const std::vector<double>* {
+        if (!daySchedule) {
+          return nullptr;
+        }
+        auto it = dayValues.find(daySchedule->handle());
+        if (it == dayValues.end()) {
+          addAnnualValuesDependency(*daySchedule);
+          it = dayValues.insert(std::make_pair(daySchedule->handle(), daySchedule->timestepValues(timestepsPerHour))).first;
+        }
+        return &it->second;
+      };
+
+      // each week is in effect until (inclusive) its date, compare on month and day only
+      unsigned j = 0;
+      for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(this->extensibleGroups())) {
+        OptionalUnsigned month = group.getUnsigned(0, true);
+        OptionalUnsigned day = group.getUnsigned(1, true);
+        OptionalWorkspaceObject object = group.getTarget(2);
+        if (!month || !day || !object || !object->optionalCast<ScheduleWeek>()) {
+          continue;
+        }
+        ScheduleWeek scheduleWeek = object->cast<ScheduleWeek>();
+        addAnnualValuesDependency(scheduleWeek);
+
+        std::vector<const std::vector<double>*> weekValues{
+          sampleDay(scheduleWeek.sundaySchedule()),   sampleDay(scheduleWeek.mondaySchedule()), sampleDay(scheduleWeek.tuesdaySchedule()),
+          sampleDay(scheduleWeek.wednesdaySchedule()), sampleDay(scheduleWeek.thursdaySchedule()), sampleDay(scheduleWeek.fridaySchedule()),
+          sampleDay(scheduleWeek.saturdaySchedule())};
+
+        unsigned untilKey = 100 * (*month) + (*day);
+        for (; (j < days.size()) && (100 * days[j].month + days[j].dayOfMonth <= untilKey); ++j) {
+          if (const std::vector<double>* values = weekValues[days[j].dayOfWeek]) {
+            std::copy(values->begin(), values->end(), result.begin() + j * numTimestepsPerDay);
+          }
+        }
+      }
+
+      return result;
+    }
+
     boost::optional<ScheduleWeek> ScheduleYear_Impl::getScheduleWeek(const openstudio::Date& date) const {
       YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
 
@@ -117,6 +117,8 @@ namespace model {
 
       //@}
      protected:
+      virtual std::vector<double> compileAnnualValues(int timestepsPerHour, int year) const override;
+
      private:
       REGISTER_LOGGER("openstudio.model.ScheduleYear");
     };
@@ -32,6 +32,9 @@
 
 #include "ScheduleBase_Impl.hpp"
 
+#include <map>
+#include <set>
+
 namespace openstudio {
 namespace model {
 
@@ -58,14 +61,49 @@ namespace model {
       // virtual destructor
       virtual ~Schedule_Impl() {}
 
+      //@}
+      /** @name Getters */
+      //@{
+
+      /// Returns the cached annual values, compiling them with compileAnnualValues on first request.
+      const std::vector<double>& annualValues(int timestepsPerHour, int year) const;
+
       //@}
      protected:
       virtual bool candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const override;
 
       virtual bool okToResetScheduleTypeLimits() const override;
 
+      /** Evaluates this schedule at the end of every timestep of year. Derived classes that can be
+       *  evaluated override this; the default implementation logs a warning and returns an empty vector.
+       *  Any object other than this one that is read must be passed to addAnnualValuesDependency. */
+      virtual std::vector<double> compileAnnualValues(int timestepsPerHour, int year) const;
+
+      /// Clears the cached annual values whenever dependency changes or is removed.
+      void addAnnualValuesDependency(const ModelObject& dependency) const;
+
+      /// Clears the cached annual values.
+      void clearAnnualValuesCache();
+
+      /// A day of the year being compiled, dayOfWeek is a DayOfWeek::domain value
+      struct AnnualDay
+      {
+        unsigned month;
+        unsigned dayOfMonth;
+        int dayOfWeek;
+      };
+
+      /// Returns every day of year, in order.
+      static std::vector<AnnualDay> annualDays(int year);
+
      private:
+      void annualValuesDependencyRemoved(const Handle& handle);
+
       REGISTER_LOGGER("openstudio.model.Schedule");
+
+      // keyed on (timestepsPerHour, year)
+      mutable std::map<std::pair<int, int>, std::vector<double>> m_annualValues;
+      mutable std::set<Handle> m_annualValuesDependencies;
     };
 
   }  // namespace detail
@@ -904,3 +904,82 @@ TEST_F(ModelFixture, ModelMerger_ClimateZones_4166) {
   EXPECT_EQ(ClimateZones::ashraeInstitutionName(), model1.getOptionalUniqueModelObject<ClimateZones>()->climateZones()[0].institution());
   EXPECT_FALSE(model2.getOptionalUniqueModelObject<ClimateZones>());
 }
+
+TEST_F(ModelFixture, ModelMerger_SkipUnchanged) {
+
+  // builds two adjacent spaces in their own zones
+  auto makeModel = [](Model& model) {
+    std::vector<Point3d> floorprint1{{0, 10, 0}, {10, 10, 0}, {10, 0, 0}, {0, 0, 0}};
+    std::vector<Point3d> floorprint2{{10, 10, 0}, {20, 10, 0}, {20, 0, 0}, {10, 0, 0}};
+
+    boost::optional<Space> space1 = Space::fromFloorPrint(floorprint1, 3, model);
+    ASSERT_TRUE(space1);
+    space1->setName("Space 1");
+    boost::optional<Space> space2 = Space::fromFloorPrint(floorprint2, 3, model);
+    ASSERT_TRUE(space2);
+    space2->setName("Space 2");
+    space1->matchSurfaces(*space2);
+
+    ThermalZone zone1(model);
+    zone1.setName("Zone 1");
+    space1->setThermalZone(zone1);
+    ThermalZone zone2(model);
+    zone2.setName("Zone 2");
+    space2->setThermalZone(zone2);
+  };
+
+  auto surfaceHandles = [](const Model& model, const std::string& spaceName) {
+    std::set<UUID> result;
+    boost::optional<Space> space = model.getConcreteModelObjectByName<Space>(spaceName);
+    if (space) {
+      for (const auto& surface : space->surfaces()) {
+        result.insert(surface.handle());
+      }
+    }
+    return result;
+  };
+
+  Model model1;
+  makeModel(model1);
+  Model model2;
+  makeModel(model2);
+
+  std::set<UUID> space1Surfaces = surfaceHandles(model1, "Space 1");
+  std::set<UUID> space2Surfaces = surfaceHandles(model1, "Space 2");
+  EXPECT_EQ(6u, space1Surfaces.size());
+  EXPECT_EQ(6u, space2Surfaces.size());
+
+  // identical model, nothing is rebuilt
+  ModelMerger mm;
+  mm.mergeModels(model1, model2, mm.suggestHandleMapping(model1, model2));
+  EXPECT_EQ(space1Surfaces, surfaceHandles(model1, "Space 1"));
+  EXPECT_EQ(space2Surfaces, surfaceHandles(model1, "Space 2"));
+
+  // change one surface in space 2, only space 2 is rebuilt
+  boost::optional<Space> space2_2 = model2.getConcreteModelObjectByName<Space>("Space 2");
+  ASSERT_TRUE(space2_2);
+  for (auto& surface : space2_2->surfaces()) {
+    if (surface.surfaceType() == "Floor") {
+      surface.setName("Renamed Floor");
+    }
+  }
+
+  mm.mergeModels(model1, model2, mm.suggestHandleMapping(model1, model2));
+  EXPECT_EQ(space1Surfaces, surfaceHandles(model1, "Space 1"));
+  std::set<UUID> newSpace2Surfaces = surfaceHandles(model1, "Space 2");
+  EXPECT_EQ(6u, newSpace2Surfaces.size());
+  EXPECT_EQ(0u, std::count_if(newSpace2Surfaces.begin(), newSpace2Surfaces.end(), [&](const UUID& h) { return space2Surfaces.count(h) > 0; }));
+  EXPECT_TRUE(model1.getConcreteModelObjectByName<Surface>("Renamed Floor"));
+
+  // the kept wall is still matched to the rebuilt one
+  unsigned numAdjacent = 0;
+  for (const auto& surface : model1.getConcreteModelObjectByName<Space>("Space 1")->surfaces()) {
+    if (boost::optional<Surface> adjacentSurface = surface.adjacentSurface()) {
+      ++numAdjacent;
+      ASSERT_TRUE(adjacentSurface->space());
+      EXPECT_EQ("Space 2", adjacentSurface->space()->nameString());
+      EXPECT_EQ(1u, newSpace2Surfaces.count(adjacentSurface->handle()));
+    }
+  }
+  EXPECT_EQ(1u, numAdjacent);
+}
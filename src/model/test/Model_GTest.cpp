@@ -36,8 +36,15 @@
 #include "../GenericModelObject.hpp"
 #include "../GenericModelObject_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
+#include "../ScheduleTypeLimits_Impl.hpp"
 #include "../ScheduleCompact.hpp"
 #include "../ScheduleCompact_Impl.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleRuleset_Impl.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleRule_Impl.hpp"
+#include "../ScheduleDay.hpp"
+#include "../ScheduleDay_Impl.hpp"
 #include "../SimulationControl.hpp"
 #include "../SimulationControl_Impl.hpp"
 #include "../OutputVariable.hpp"
@@ -69,11 +76,27 @@
 #include "../Space_Impl.hpp"
 #include "../Surface.hpp"
 #include "../Surface_Impl.hpp"
+#include "../SubSurface.hpp"
+#include "../SubSurface_Impl.hpp"
+#include "../SurfacePropertyConvectionCoefficients.hpp"
+#include "../SurfacePropertyConvectionCoefficients_Impl.hpp"
+#include "../FoundationKiva.hpp"
+#include "../FoundationKiva_Impl.hpp"
+#include "../ShadingControl.hpp"
+#include "../ShadingControl_Impl.hpp"
+#include "../Construction.hpp"
+#include "../Construction_Impl.hpp"
 
 #include "../FanConstantVolume.hpp"
 #include "../FanConstantVolume_Impl.hpp"
 #include "../AirLoopHVAC.hpp"
 #include "../AirLoopHVAC_Impl.hpp"
+#include "../HVACComponent.hpp"
+#include "../HVACComponent_Impl.hpp"
+#include "../SpaceLoadInstance.hpp"
+#include "../SpaceLoadInstance_Impl.hpp"
+#include "../ConstructionBase.hpp"
+#include "../ConstructionBase_Impl.hpp"
 
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/data/TimeSeries.hpp"
@@ -454,6 +477,59 @@ TEST_F(ExampleModelFixture, ExampleModel) {
   }
 }
 
+template <typename T>
+std::vector<Handle> scanForModelObjects(const Model& model, bool sorted) {
+  std::vector<Handle> result;
+  for (const WorkspaceObject& object : model.objects(sorted)) {
+    if (object.optionalCast<T>()) {
+      result.push_back(object.handle());
+    }
+  }
+  return result;
+}
+
+template <typename T>
+void checkModelObjectsMatchScan(const Model& model) {
+  std::vector<Handle> expected = scanForModelObjects<T>(model, false);
+  std::vector<Handle> actual = getHandles(model.getModelObjects<T>());
+  std::sort(expected.begin(), expected.end());
+  std::sort(actual.begin(), actual.end());
+  EXPECT_EQ(expected, actual);
+
+  // sorted order is preserved
+  EXPECT_EQ(scanForModelObjects<T>(model, true), getHandles(model.getModelObjects<T>(true)));
+}
+
+TEST_F(ExampleModelFixture, ExampleModel_GetModelObjectsByFamily) {
+  Model model = exampleModel();
+
+  checkModelObjectsMatchScan<ModelObject>(model);
+  checkModelObjectsMatchScan<ParentObject>(model);
+  checkModelObjectsMatchScan<HVACComponent>(model);
+  checkModelObjectsMatchScan<SpaceLoadInstance>(model);
+  checkModelObjectsMatchScan<ConstructionBase>(model);
+  EXPECT_EQ(model.modelObjects().size(), model.getModelObjects<ModelObject>().size());
+
+  // the family index picks up types that were not in the model when it was first queried
+  EXPECT_TRUE(model.getConcreteModelObjects<FanConstantVolume>().empty());
+  std::size_t nHVACComponents = model.getModelObjects<HVACComponent>().size();
+  FanConstantVolume fan(model);
+  EXPECT_EQ(nHVACComponents + 1u, model.getModelObjects<HVACComponent>().size());
+  checkModelObjectsMatchScan<HVACComponent>(model);
+  checkModelObjectsMatchScan<ModelObject>(model);
+
+  // and drops types whose last object was removed
+  fan.remove();
+  EXPECT_EQ(nHVACComponents, model.getModelObjects<HVACComponent>().size());
+
+  std::vector<IddObjectType> types =
+    model.iddObjectTypesOfFamily(typeid(openstudio::model::detail::SpaceLoadInstance_Impl), [](const WorkspaceObject& object) {
+      return static_cast<bool>(object.getImpl<openstudio::model::detail::SpaceLoadInstance_Impl>());
+    });
+  EXPECT_NE(types.end(), std::find(types.begin(), types.end(), IddObjectType(IddObjectType::OS_Lights)));
+  EXPECT_EQ(types.end(), std::find(types.begin(), types.end(), IddObjectType(IddObjectType::OS_Space)));
+}
+
 TEST_F(ExampleModelFixture, ExampleModel_Save) {
   Model model = exampleModel();
 
@@ -755,3 +831,138 @@ TEST_F(ModelFixture, Model_BadSwaps) {
   EXPECT_ANY_THROW(workspace.swap(model));
   EXPECT_ANY_THROW(model.swap(workspace));
 }
+
+TEST_F(ModelFixture, Model_CloneMany) {
+  Model model;
+  ScheduleTypeLimits limits(model);
+  ScheduleRuleset ruleset(model, 1.0);
+  ruleset.setName("Template Schedule");
+  EXPECT_TRUE(ruleset.setScheduleTypeLimits(limits));
+  ScheduleRule rule(ruleset);
+  EXPECT_TRUE(rule.daySchedule().addValue(Time(1, 0), 0.5));
+  ASSERT_EQ(1u, ruleset.scheduleRules().size());
+
+  CloneOptions options;
+  options.numberOfCopies = 3;
+  std::vector<ModelObject> clones = Model::cloneMany({ruleset}, model, options);
+  ASSERT_EQ(3u, clones.size());
+  EXPECT_EQ(4u, model.getConcreteModelObjects<ScheduleRuleset>().size());
+  EXPECT_EQ(4u, model.getConcreteModelObjects<ScheduleRule>().size());
+  EXPECT_EQ(1u, model.getConcreteModelObjects<ScheduleTypeLimits>().size());
+
+  std::set<std::string> names{ruleset.nameString()};
+  std::set<Handle> dayHandles{ruleset.defaultDaySchedule().handle(), rule.daySchedule().handle()};
+  for (const ModelObject& clone : clones) {
+    ScheduleRuleset copy = clone.cast<ScheduleRuleset>();
+    EXPECT_NE(ruleset.handle(), copy.handle());
+    EXPECT_TRUE(names.insert(copy.nameString()).second);
+    EXPECT_EQ(0u, copy.nameString().find("Template Schedule "));
+
+    // resources are shared
+    ASSERT_TRUE(copy.scheduleTypeLimits());
+    EXPECT_EQ(limits.handle(), copy.scheduleTypeLimits()->handle());
+
+    // children are copied and point to their own copy of the parent
+    EXPECT_TRUE(dayHandles.insert(copy.defaultDaySchedule().handle()).second);
+    std::vector<ScheduleRule> rules = copy.scheduleRules();
+    ASSERT_EQ(1u, rules.size());
+    EXPECT_EQ(copy.handle(), rules[0].scheduleRuleset().handle());
+    EXPECT_TRUE(dayHandles.insert(rules[0].daySchedule().handle()).second);
+    EXPECT_EQ(0.5, rules[0].daySchedule().values()[0]);
+  }
+  EXPECT_EQ(1u, ruleset.scheduleRules().size());
+
+  // into another model, the resources come along once
+  Model other;
+  clones = Model::cloneMany({ruleset}, other, options);
+  ASSERT_EQ(3u, clones.size());
+  EXPECT_EQ(3u, other.getConcreteModelObjects<ScheduleRuleset>().size());
+  EXPECT_EQ(3u, other.getConcreteModelObjects<ScheduleRule>().size());
+  EXPECT_EQ(1u, other.getConcreteModelObjects<ScheduleTypeLimits>().size());
+  for (const ModelObject& clone : clones) {
+    EXPECT_EQ(other, clone.model());
+    ASSERT_TRUE(clone.cast<ScheduleRuleset>().scheduleTypeLimits());
+  }
+
+  // unique objects cannot be stamped out
+  EXPECT_TRUE(Model::cloneMany({model.getUniqueModelObject<SimulationControl>()}, other, options).empty());
+
+  // HVAC components and loops go through their clone overrides
+  FanConstantVolume fan(model);
+  AirLoopHVAC airLoop(model);
+  ThermalZone thermalZone(model);
+  clones = Model::cloneMany({fan, airLoop}, model, options);
+  ASSERT_EQ(6u, clones.size());
+  for (unsigned k = 0; k < 3; ++k) {
+    EXPECT_TRUE(clones[2 * k].optionalCast<FanConstantVolume>());
+    EXPECT_TRUE(clones[2 * k + 1].optionalCast<AirLoopHVAC>());
+  }
+  EXPECT_EQ(4u, model.getConcreteModelObjects<FanConstantVolume>().size());
+  EXPECT_EQ(4u, model.getConcreteModelObjects<AirLoopHVAC>().size());
+  clones = Model::cloneMany({thermalZone}, model, options);
+  ASSERT_EQ(3u, clones.size());
+  EXPECT_EQ(4u, model.getConcreteModelObjects<ThermalZone>().size());
+}
+
+TEST_F(ModelFixture, Model_CloneMany_Space) {
+  Model model;
+  Space space(model);
+  std::vector<Point3d> wallVertices{{0, 0, 3}, {0, 0, 0}, {10, 0, 0}, {10, 0, 3}};
+  Surface wall(wallVertices, model);
+  EXPECT_TRUE(wall.setSpace(space));
+  std::vector<Point3d> windowVertices{{2, 0, 2}, {2, 0, 1}, {4, 0, 1}, {4, 0, 2}};
+  SubSurface window(windowVertices, model);
+  EXPECT_TRUE(window.setSurface(wall));
+
+  SurfacePropertyConvectionCoefficients wallCoefficients(wall);
+  SurfacePropertyConvectionCoefficients windowCoefficients(window);
+  FoundationKiva kiva(model);
+  EXPECT_TRUE(wall.setAdjacentFoundation(kiva));
+  Construction construction(model);
+  ShadingControl shadingControl(construction);
+  EXPECT_TRUE(window.addShadingControl(shadingControl));
+
+  // plain objects in the same call are still copied in bulk
+  ScheduleRuleset ruleset(model, 1.0);
+
+  CloneOptions options;
+  options.numberOfCopies = 2;
+  std::vector<ModelObject> clones = Model::cloneMany({space, ruleset}, model, options);
+  ASSERT_EQ(4u, clones.size());
+  EXPECT_EQ(3u, model.getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(3u, model.getConcreteModelObjects<ScheduleRuleset>().size());
+
+  // data copied by the clone overrides of Surface and SubSurface survives
+  EXPECT_EQ(6u, model.getConcreteModelObjects<SurfacePropertyConvectionCoefficients>().size());
+  EXPECT_EQ(3u, model.getConcreteModelObjects<FoundationKiva>().size());
+  EXPECT_EQ(3u, model.getConcreteModelObjects<ShadingControl>().size());
+  for (unsigned k = 0; k < 2; ++k) {
+    ASSERT_TRUE(clones[2 * k].optionalCast<Space>());
+    ASSERT_TRUE(clones[2 * k + 1].optionalCast<ScheduleRuleset>());
+    Space copy = clones[2 * k].cast<Space>();
+    EXPECT_NE(space.handle(), copy.handle());
+
+    std::vector<Surface> surfaces = copy.surfaces();
+    ASSERT_EQ(1u, surfaces.size());
+    EXPECT_NE(wall.handle(), surfaces[0].handle());
+    ASSERT_TRUE(surfaces[0].surfacePropertyConvectionCoefficients());
+    EXPECT_NE(wallCoefficients.handle(), surfaces[0].surfacePropertyConvectionCoefficients()->handle());
+    ASSERT_TRUE(surfaces[0].adjacentFoundation());
+    EXPECT_NE(kiva.handle(), surfaces[0].adjacentFoundation()->handle());
+
+    std::vector<SubSurface> subSurfaces = surfaces[0].subSurfaces();
+    ASSERT_EQ(1u, subSurfaces.size());
+    EXPECT_NE(window.handle(), subSurfaces[0].handle());
+    ASSERT_TRUE(subSurfaces[0].surfacePropertyConvectionCoefficients());
+    EXPECT_NE(windowCoefficients.handle(), subSurfaces[0].surfacePropertyConvectionCoefficients()->handle());
+    std::vector<ShadingControl> shadingControls = subSurfaces[0].shadingControls();
+    ASSERT_EQ(1u, shadingControls.size());
+    EXPECT_NE(shadingControl.handle(), shadingControls[0].handle());
+  }
+
+  // the originals are untouched
+  ASSERT_TRUE(wall.surfacePropertyConvectionCoefficients());
+  EXPECT_EQ(wallCoefficients.handle(), wall.surfacePropertyConvectionCoefficients()->handle());
+  ASSERT_EQ(1u, window.shadingControls().size());
+  EXPECT_EQ(shadingControl.handle(), window.shadingControls()[0].handle());
+}
@@ -40,8 +40,23 @@
 #include "../StandardsInformationConstruction_Impl.hpp"
 #include "../StandardOpaqueMaterial.hpp"
 #include "../StandardOpaqueMaterial_Impl.hpp"
+#include "../Lights.hpp"
+#include "../Lights_Impl.hpp"
+#include "../LightsDefinition.hpp"
+#include "../LightsDefinition_Impl.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleRuleset_Impl.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleRule_Impl.hpp"
+#include "../ScheduleDay.hpp"
+#include "../ScheduleDay_Impl.hpp"
+#include "../ScheduleTypeLimits.hpp"
+#include "../ScheduleTypeLimits_Impl.hpp"
+#include "../ExternalFile.hpp"
+#include "../ExternalFile_Impl.hpp"
 
 #include "../../utilities/core/Optional.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -134,3 +149,57 @@ TEST_F(ModelFixture, ResourceObject_Clone) {
   EXPECT_EQ("Material with Changed Data", newConstruction.layers()[0].name().get());
   EXPECT_EQ("Material 1", anotherNewConstruction.layers()[0].name().get());
 }
+
+TEST_F(ModelFixture, ResourceObject_PurgeUnusedResourceObjects) {
+  Model model;
+
+  // used: Lights -> LightsDefinition, Lights -> ScheduleRuleset -> ScheduleTypeLimits
+  LightsDefinition definition(model);
+  Lights lights(definition);
+  ScheduleTypeLimits usedLimits(model);
+  ScheduleRuleset usedSchedule(model);
+  EXPECT_TRUE(usedSchedule.setScheduleTypeLimits(usedLimits));
+  EXPECT_TRUE(lights.setSchedule(usedSchedule));
+
+  // unused chains, only referenced by other unused resources or by their own children
+  StandardOpaqueMaterial material(model);
+  Construction construction(model);
+  EXPECT_TRUE(construction.setLayers(MaterialVector(1u, material)));
+  construction.standardsInformation();
+  ScheduleTypeLimits unusedLimits(model);
+  ScheduleRuleset unusedSchedule(model);
+  EXPECT_TRUE(unusedSchedule.setScheduleTypeLimits(unusedLimits));
+  ScheduleRule rule(unusedSchedule);
+
+  // unused resource with a remove override, which deletes the file copied into the model's files
+  path p = resourcesPath() / toPath("model/schedulefile.csv");
+  boost::optional<ExternalFile> externalFile = ExternalFile::getExternalFile(model, openstudio::toString(p));
+  ASSERT_TRUE(externalFile);
+  openstudio::path externalFilePath = externalFile->filePath();
+  EXPECT_TRUE(exists(externalFilePath));
+
+  std::size_t nObjects = model.numObjects();
+  IdfObjectVector removed = model.purgeUnusedResourceObjects();
+  EXPECT_EQ(nObjects - removed.size(), model.numObjects());
+
+  EXPECT_FALSE(material.initialized());
+  EXPECT_FALSE(construction.initialized());
+  EXPECT_TRUE(model.getConcreteModelObjects<StandardsInformationConstruction>().empty());
+  EXPECT_FALSE(unusedLimits.initialized());
+  EXPECT_FALSE(unusedSchedule.initialized());
+  EXPECT_FALSE(rule.initialized());
+  EXPECT_FALSE(externalFile->initialized());
+  EXPECT_FALSE(exists(externalFilePath));
+
+  EXPECT_TRUE(definition.initialized());
+  EXPECT_TRUE(lights.initialized());
+  EXPECT_TRUE(usedLimits.initialized());
+  EXPECT_TRUE(usedSchedule.initialized());
+  EXPECT_TRUE(usedSchedule.defaultDaySchedule().initialized());
+  for (const ResourceObject& resource : model.getModelObjects<ResourceObject>()) {
+    EXPECT_GT(resource.nonResourceObjectUseCount(true), 0u) << resource.briefDescription();
+  }
+
+  // nothing left to purge
+  EXPECT_TRUE(model.purgeUnusedResourceObjects().empty());
+}
@@ -328,6 +328,26 @@ TEST_F(ModelFixture, ScheduleFile) {
   ASSERT_TRUE(schedule3.minutesperItem());
   EXPECT_EQ("60", schedule3.minutesperItem().get());
 
+  // values are read straight from the file
+  ScheduleFile schedule4(*externalfile, 3, 1);
+  std::vector<double> values = schedule4.values();
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(0.207618053, values.front());
+  EXPECT_DOUBLE_EQ(0.621459952, values.back());
+  TimeSeries timeSeries = schedule4.timeSeries();
+  EXPECT_EQ(8760u, timeSeries.values().size());
+  ASSERT_TRUE(timeSeries.intervalLength());
+  EXPECT_EQ(Time(0, 1), *timeSeries.intervalLength());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1), Time(0, 1)), timeSeries.firstReportDateTime());
+
+  EXPECT_TRUE(schedule4.setNumberofHoursofData(24));
+  EXPECT_EQ(24u, schedule4.values().size());
+
+  // header row is not numeric
+  EXPECT_TRUE(schedule4.setRowstoSkipatTop(0));
+  EXPECT_TRUE(schedule4.values().empty());
+  schedule4.remove();
+
   // shouldn't create a new object
   boost::optional<ExternalFile> externalfile2 = ExternalFile::getExternalFile(model, openstudio::toString(p));
   ASSERT_TRUE(externalfile2);
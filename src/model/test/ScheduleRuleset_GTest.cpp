@@ -1010,3 +1010,43 @@ Nov 11  Veterans Day
 Nov 26  Thanksgiving Day
 Dec 25  Christmas Day
 */
+
+TEST_F(ModelFixture, ScheduleRuleset_AnnualValues) {
+  Model model;
+  ScheduleRuleset schedule(model, 0.0);
+  ScheduleRule rule(schedule);
+  EXPECT_TRUE(rule.setApplyWeekdays(true));
+  ScheduleDay daySchedule = rule.daySchedule();
+  daySchedule.clearValues();
+  EXPECT_TRUE(daySchedule.addValue(Time(0, 8, 0), 0.0));
+  EXPECT_TRUE(daySchedule.addValue(Time(0, 18, 0), 1.0));
+  EXPECT_TRUE(daySchedule.addValue(Time(0, 24, 0), 0.0));
+
+  std::vector<double> values = schedule.annualValues(4, 2009);
+  ASSERT_EQ(8760u * 4u, values.size());
+
+  // 2009-01-01 is a Thursday, values are reported at the end of each timestep
+  for (unsigned i = 0; i < 96; ++i) {
+    EXPECT_DOUBLE_EQ(daySchedule.getValue(Time(0, 0, 15 * (i + 1))), values[i]);
+  }
+  EXPECT_DOUBLE_EQ(0.0, values[31]);
+  EXPECT_DOUBLE_EQ(1.0, values[32]);
+  EXPECT_DOUBLE_EQ(1.0, values[71]);
+  EXPECT_DOUBLE_EQ(0.0, values[72]);
+
+  // 2009-01-03 is a Saturday
+  EXPECT_DOUBLE_EQ(0.0, values[2 * 96 + 48]);
+
+  // editing a day schedule invalidates the cached values
+  EXPECT_TRUE(daySchedule.addValue(Time(0, 18, 0), 0.5));
+  EXPECT_DOUBLE_EQ(0.5, schedule.annualValues(4, 2009)[48]);
+
+  // so does adding or removing a rule
+  ScheduleRule rule2(schedule, ScheduleDay(model, 0.25));
+  EXPECT_TRUE(rule2.setApplyAllDays(true));
+  EXPECT_DOUBLE_EQ(0.25, schedule.annualValues(4, 2009)[48]);
+  rule2.remove();
+  EXPECT_DOUBLE_EQ(0.5, schedule.annualValues(4, 2009)[48]);
+  rule.remove();
+  EXPECT_DOUBLE_EQ(0.0, schedule.annualValues(4, 2009)[48]);
+}
@@ -32,8 +32,11 @@
 #include "ModelFixture.hpp"
 #include "../ScheduleConstant.hpp"
 #include "../ScheduleConstant_Impl.hpp"
+#include "../ScheduleCompact.hpp"
+#include "../ScheduleCompact_Impl.hpp"
 #include "../ScheduleTypeRegistry.hpp"
 
+#include "../../utilities/idf/IdfExtensibleGroup.hpp"
 #include "../../utilities/idf/ValidityReport.hpp"
 
 using namespace openstudio::model;
@@ -50,3 +53,53 @@ TEST_F(ModelFixture, Schedule_FinalStrictness) {
   report = schedule.validityReport(StrictnessLevel(StrictnessLevel::Final));
   EXPECT_EQ(0u, report.numErrors());
 }
+
+TEST_F(ModelFixture, Schedule_AnnualValues) {
+  Model model;
+  ScheduleConstant schedule(model);
+  schedule.setValue(0.5);
+
+  std::vector<double> values = schedule.annualValues(4, 2009);
+  ASSERT_EQ(8760u * 4u, values.size());
+  EXPECT_DOUBLE_EQ(0.5, values.front());
+  EXPECT_DOUBLE_EQ(0.5, values.back());
+
+  // cached values are invalidated on edits
+  schedule.setValue(0.75);
+  EXPECT_DOUBLE_EQ(0.75, schedule.annualValues(4, 2009)[100]);
+
+  // leap year
+  EXPECT_EQ(8784u, schedule.annualValues(1, 2012).size());
+
+  // timesteps per hour must evenly divide 60
+  EXPECT_TRUE(schedule.annualValues(7, 2009).empty());
+}
+
+TEST_F(ModelFixture, Schedule_AnnualValues_Compact) {
+  Model model;
+  ScheduleCompact schedule(model);
+  std::vector<std::string> fields{"Through: 6/30", "For: Weekdays", "Until: 08:00", "0.0",   "Until: 24:00", "1.0",
+                                  "For: AllOtherDays", "Until: 24:00", "0.25", "Through: 12/31", "For: AllDays", "Until: 24:00", "0.5"};
+  for (const std::string& field : fields) {
+    EXPECT_FALSE(schedule.pushExtensibleGroup(std::vector<std::string>{field}).empty());
+  }
+
+  std::vector<double> values = schedule.annualValues(1, 2009);
+  ASSERT_EQ(8760u, values.size());
+
+  // 2009-01-01 is a Thursday
+  EXPECT_DOUBLE_EQ(0.0, values[7]);
+  EXPECT_DOUBLE_EQ(1.0, values[8]);
+  EXPECT_DOUBLE_EQ(1.0, values[23]);
+
+  // 2009-01-03 is a Saturday
+  EXPECT_DOUBLE_EQ(0.25, values[2 * 24 + 12]);
+
+  // second half of the year
+  EXPECT_DOUBLE_EQ(0.5, values[181 * 24 + 12]);
+  EXPECT_DOUBLE_EQ(0.5, values.back());
+
+  // cached values are invalidated on edits
+  schedule.setToConstantValue(2.0);
+  EXPECT_DOUBLE_EQ(2.0, schedule.annualValues(1, 2009)[8]);
+}
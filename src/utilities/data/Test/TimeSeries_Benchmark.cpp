@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include "../TimeSeries.hpp"
+#include "../Vector.hpp"
+#include "../../time/Date.hpp"
+#include "../../time/Time.hpp"
+
+using namespace openstudio;
+
+static TimeSeries hourlyTimeSeries(const DateTime& firstReport) {
+  return TimeSeries(firstReport, Time(0, 1), linspace(1, 8760, 8760), "W");
+}
+
+static DateTime firstReport() {
+  return DateTime(Date(MonthOfYear::Jan, 1, 2019), Time(0, 1, 0, 0));
+}
+
+static void BM_AddSameAxis(benchmark::State& state) {
+  TimeSeries timeSeries1 = hourlyTimeSeries(firstReport());
+  TimeSeries timeSeries2 = hourlyTimeSeries(firstReport());
+
+  for (auto _ : state) {
+    TimeSeries result = timeSeries1 + timeSeries2;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+static void BM_AddShiftedAxis(benchmark::State& state) {
+  TimeSeries timeSeries1 = hourlyTimeSeries(firstReport());
+  TimeSeries timeSeries2 = hourlyTimeSeries(firstReport() + Time(1.0));
+
+  for (auto _ : state) {
+    TimeSeries result = timeSeries1 + timeSeries2;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+static void BM_AddMergedAxis(benchmark::State& state) {
+  TimeSeries timeSeries1 = hourlyTimeSeries(firstReport());
+  TimeSeries timeSeries2 = hourlyTimeSeries(firstReport() + Time(0, 0, 30, 0));
+
+  for (auto _ : state) {
+    TimeSeries result = timeSeries1 + timeSeries2;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+static void BM_AddDetailed(benchmark::State& state) {
+  TimeSeries interval = hourlyTimeSeries(firstReport());
+  TimeSeries detailed(interval.dateTimes(), interval.values(), "W");
+
+  for (auto _ : state) {
+    TimeSeries result = detailed + detailed;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// Construction of a regular series no longer fills any time axis arrays
+static void BM_ConstructRegular(benchmark::State& state) {
+  Vector values = linspace(1, 35040, 35040);
+
+  for (auto _ : state) {
+    TimeSeries result(firstReport(), Time(0, 0, 15, 0), values, "W");
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+static void BM_ValueRegular(benchmark::State& state) {
+  TimeSeries timeSeries = hourlyTimeSeries(firstReport());
+  DateTimeVector dateTimes = timeSeries.dateTimes();
+
+  for (auto _ : state) {
+    double total = 0.0;
+    for (const DateTime& dateTime : dateTimes) {
+      total += timeSeries.value(dateTime);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+}
+
+static void BM_ValueDetailed(benchmark::State& state) {
+  TimeSeries interval = hourlyTimeSeries(firstReport());
+  TimeSeries timeSeries(interval.dateTimes(), interval.values(), "W");
+  DateTimeVector dateTimes = timeSeries.dateTimes();
+
+  for (auto _ : state) {
+    double total = 0.0;
+    for (const DateTime& dateTime : dateTimes) {
+      total += timeSeries.value(dateTime);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+}
+
+BENCHMARK(BM_AddSameAxis)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AddShiftedAxis)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AddMergedAxis)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AddDetailed)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConstructRegular);
+BENCHMARK(BM_ValueRegular)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ValueDetailed)->Unit(benchmark::kMillisecond);
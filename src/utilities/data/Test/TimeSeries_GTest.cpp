@@ -2119,3 +2119,143 @@ TEST_F(DataFixture, TimeSeries_value_DateTime_NoYear) {
     }
   }
 }
+
+TEST_F(DataFixture, TimeSeries_AddSubtractAligned) {
+  std::string units = "W";
+  Time interval = Time(0, 1);
+  Vector values1 = linspace(1, 8760, 8760);
+  Vector values2 = linspace(8760, 1, 8760);
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2019), Time(0, 1, 0, 0));
+
+  TimeSeries timeSeries1(firstReport, interval, values1, units);
+  TimeSeries timeSeries2(firstReport, interval, values2, units);
+
+  // same axis, element-wise and still regular
+  TimeSeries sum = timeSeries1 + timeSeries2;
+  TimeSeries diff = timeSeries1 - timeSeries2;
+  ASSERT_EQ(8760u, sum.values().size());
+  ASSERT_EQ(8760u, diff.values().size());
+  ASSERT_TRUE(sum.intervalLength());
+  EXPECT_EQ(interval, *sum.intervalLength());
+  EXPECT_EQ(firstReport, sum.firstReportDateTime());
+  Vector sumValues = sum.values();
+  Vector diffValues = diff.values();
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(8761.0, sumValues[i]);
+    EXPECT_EQ(values1[i] - values2[i], diffValues[i]);
+  }
+
+  // shifted by a day, the union of both axes is still regular
+  TimeSeries shifted(firstReport + Time(1.0), interval, values2, units);
+  TimeSeries shiftedSum = timeSeries1 + shifted;
+  ASSERT_EQ(8760u + 24u, shiftedSum.values().size());
+  ASSERT_TRUE(shiftedSum.intervalLength());
+  EXPECT_EQ(firstReport, shiftedSum.firstReportDateTime());
+  DateTimeVector dateTimes = shiftedSum.dateTimes();
+  Vector shiftedSumValues = shiftedSum.values();
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    EXPECT_EQ(timeSeries1.value(dateTimes[i]) + shifted.value(dateTimes[i]), shiftedSumValues[i]) << dateTimes[i];
+  }
+  EXPECT_EQ(1.0, shiftedSumValues[0]);
+  EXPECT_EQ(1.0, shiftedSumValues[8760 + 23]);
+
+  // reversing the operands gives the same axis
+  TimeSeries shiftedDiff = shifted - timeSeries1;
+  ASSERT_EQ(8760u + 24u, shiftedDiff.values().size());
+  EXPECT_EQ(firstReport, shiftedDiff.firstReportDateTime());
+
+  // not aligned, falls back to merging both axes
+  TimeSeries halfHour(firstReport + Time(0, 0, 30, 0), interval, values2, units);
+  TimeSeries mergedSum = timeSeries1 + halfHour;
+  EXPECT_EQ(2u * 8760u, mergedSum.values().size());
+  dateTimes = mergedSum.dateTimes();
+  Vector mergedSumValues = mergedSum.values();
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    EXPECT_EQ(timeSeries1.value(dateTimes[i]) + halfHour.value(dateTimes[i]), mergedSumValues[i]) << dateTimes[i];
+  }
+
+  // detailed series with a year use a single walk along each axis
+  DateTimeVector detailedDateTimes;
+  for (unsigned i = 0; i < 100; ++i) {
+    detailedDateTimes.push_back(firstReport + Time(0, 0, 90 * i, 0));
+  }
+  TimeSeries detailed(detailedDateTimes, linspace(1, 100, 100), units);
+  TimeSeries detailedDiff = detailed - timeSeries1;
+  dateTimes = detailedDiff.dateTimes();
+  Vector detailedDiffValues = detailedDiff.values();
+  ASSERT_EQ(dateTimes.size(), detailedDiffValues.size());
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    EXPECT_EQ(detailed.value(dateTimes[i]) - timeSeries1.value(dateTimes[i]), detailedDiffValues[i]) << dateTimes[i];
+  }
+}
+
+TEST_F(DataFixture, TimeSeries_RegularImplicitAxis) {
+  std::string units = "W";
+  Time interval = Time(0, 0, 15, 0);
+  Vector values = linspace(1, 35040, 35040);
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2019), Time(0, 0, 15, 0));
+
+  TimeSeries timeSeries(firstReport, interval, values, units);
+
+  // the time axis is computed from the interval
+  std::vector<long> seconds = timeSeries.secondsFromFirstReport();
+  ASSERT_EQ(35040u, seconds.size());
+  EXPECT_EQ(0, seconds.front());
+  EXPECT_EQ(35039 * 900, seconds.back());
+  EXPECT_EQ(900 * 1000, timeSeries.secondsFromFirstReport(1000));
+  EXPECT_DOUBLE_EQ(1.0, timeSeries.daysFromFirstReport(96));
+  DateTimeVector dateTimes = timeSeries.dateTimes();
+  ASSERT_EQ(35040u, dateTimes.size());
+  EXPECT_EQ(firstReport, dateTimes.front());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2020), Time(0, 0, 0, 0)), dateTimes.back());
+
+  for (unsigned i = 0; i < 35040; i += 97) {
+    EXPECT_EQ(values[i], timeSeries.value(dateTimes[i]));
+    // within the interval ending at dateTimes[i]
+    EXPECT_EQ(values[i], timeSeries.value(dateTimes[i] - Time(0, 0, 0, 1)));
+  }
+  EXPECT_EQ(0, timeSeries.value(firstReport + Time(0, 0, 0, 35039 * 900 + 1)));
+
+  EXPECT_DOUBLE_EQ(900.0 * 35040.0 * 35041.0 / 2.0, timeSeries.integrate());
+  EXPECT_DOUBLE_EQ(35041.0 / 2.0, timeSeries.averageValue());
+
+  Vector day = timeSeries.values(DateTime(Date(MonthOfYear::Jan, 2, 2019), Time(0, 0, 15, 0)), DateTime(Date(MonthOfYear::Jan, 3, 2019), Time(0)));
+  ASSERT_EQ(96u, day.size());
+  EXPECT_EQ(97.0, day[0]);
+
+  // detailed series keep their explicit axis, reports sharing a time resolve like interp with HoldNextInterp
+  std::vector<long> detailedSeconds{3600, 7200, 7200, 10800, 10800};
+  Vector detailedValues = linspace(1, 5, 5);
+  TimeSeries detailed(firstReport, detailedSeconds, detailedValues, units);
+  EXPECT_FALSE(detailed.intervalLength());
+  EXPECT_EQ(2.0, detailed.value(Time(0, 0, 30, 0)));
+  EXPECT_EQ(2.0, detailed.value(Time(0, 1, 0, 0)));
+  EXPECT_EQ(4.0, detailed.value(Time(0, 1, 30, 0)));
+  EXPECT_EQ(5.0, detailed.value(Time(0, 2, 0, 0)));
+  EXPECT_EQ(0.0, detailed.value(Time(0, 2, 0, 1)));
+  EXPECT_DOUBLE_EQ(3600.0 * (1 + 2 + 0 + 4 + 0), detailed.integrate());
+  EXPECT_DOUBLE_EQ(3600.0 * 7 / 10800.0, detailed.averageValue());
+}
+
+TEST_F(DataFixture, TimeSeries_AddSubtract_RepeatedFirstReport) {
+  // several reports at the first report time, the series has no duration and holds the first of them like value() does
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2019), Time(0, 1, 0, 0));
+  Vector values(2);
+  values[0] = 5.0;
+  values[1] = 7.0;
+  TimeSeries repeated(firstReport, std::vector<long>{0, 0}, values, "W");
+  EXPECT_EQ(5.0, repeated.value(firstReport));
+
+  Vector otherValues(1);
+  otherValues[0] = 1.0;
+  TimeSeries other(firstReport, std::vector<long>{0}, otherValues, "W");
+
+  TimeSeries sum = repeated + other;
+  ASSERT_EQ(1u, sum.values().size());
+  EXPECT_EQ(firstReport, sum.firstReportDateTime());
+  EXPECT_EQ(6.0, sum.values()[0]);
+
+  TimeSeries diff = other - repeated;
+  ASSERT_EQ(1u, diff.values().size());
+  EXPECT_EQ(-4.0, diff.values()[0]);
+}
@@ -30,6 +30,9 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 using namespace std;
 using namespace boost;
 
@@ -37,11 +40,10 @@ namespace openstudio {
 
 namespace detail {
 
-  TimeSeries_Impl::TimeSeries_Impl() : m_outOfRangeValue(0.0), m_wrapAround(false) {}
+  TimeSeries_Impl::TimeSeries_Impl() : m_firstIntervalSeconds(0), m_outOfRangeValue(0.0), m_wrapAround(false) {}
 
   TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+    : m_firstIntervalSeconds(intervalLength.totalSeconds()),
       m_values(values),
       m_units(units),
       m_intervalLength(intervalLength),
@@ -51,25 +53,14 @@ namespace detail {
       LOG(Warn, "Creating empty timeseries");
     }
 
-    // length of interval in seconds
-    int secondsPerInterval = intervalLength.totalSeconds();
-
     // date and time of first report, end of the first reporting interval
     // DLM: startDate may or may not have baseYear defined
     m_firstReportDateTime = DateTime(startDate, intervalLength);
 
     m_startDateTime = DateTime(startDate, Time(0));
 
-    for (unsigned i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
-    }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-    long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
-    }
+    // regular series do not store their time axis, seconds from first report are computed from the interval
+    long durationSeconds = this->durationSeconds();
 
     // check for wrap around
     boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
@@ -83,8 +74,7 @@ namespace detail {
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+    : m_firstIntervalSeconds(intervalLength.totalSeconds()),
       m_values(values),
       m_units(units),
       m_intervalLength(intervalLength),
@@ -94,24 +84,13 @@ namespace detail {
       LOG(Warn, "Creating empty timeseries");
     }
 
-    // length of interval in seconds
-    int secondsPerInterval = intervalLength.totalSeconds();
-
     // DLM: startDate may or may not have baseYear defined
     m_firstReportDateTime = DateTime(firstReportDateTime.date(), firstReportDateTime.time());
 
     m_startDateTime = m_firstReportDateTime - intervalLength;
 
-    for (unsigned i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
-    }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-    long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
-    }
+    // regular series do not store their time axis, seconds from first report are computed from the interval
+    long durationSeconds = this->durationSeconds();
 
     // check for wrap around
     boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
@@ -126,7 +105,7 @@ namespace detail {
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
     : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -154,10 +133,10 @@ namespace detail {
         LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in "
                   "the future.");
         m_startDateTime = DateTime(m_firstReportDateTime.date());
+        m_firstIntervalSeconds = firstIntervalSeconds;
 
         for (unsigned i = 0; i < values.size(); ++i) {
           m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -166,9 +145,9 @@ namespace detail {
         }
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+        m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -177,12 +156,7 @@ namespace detail {
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-      long durationSeconds = 0;
-      if (!m_secondsFromFirstReport.empty()) {
-        durationSeconds = m_secondsFromFirstReport.back();
-      }
+      long durationSeconds = this->durationSeconds();
 
       // check for wrap around
       boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
@@ -199,7 +173,7 @@ namespace detail {
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values,
                                    const std::string& units)
     : m_secondsFromFirstReport(timeInDays.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values.size()),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -228,10 +202,10 @@ namespace detail {
         LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in "
                   "the future.");
         m_startDateTime = DateTime(m_firstReportDateTime.date());
+        m_firstIntervalSeconds = firstIntervalSeconds;
 
         for (unsigned i = 0; i < values.size(); ++i) {
           m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -240,9 +214,9 @@ namespace detail {
         }
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+        m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -251,12 +225,7 @@ namespace detail {
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-      long durationSeconds = 0;
-      if (!m_secondsFromFirstReport.empty()) {
-        durationSeconds = m_secondsFromFirstReport.back();
-      }
+      long durationSeconds = this->durationSeconds();
 
       // check for wrap around
       boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
@@ -272,7 +241,7 @@ namespace detail {
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
     : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -314,7 +283,6 @@ namespace detail {
       // Compute the seconds from first report
       if (m_wrapAround) {
         m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
         int delta = 0;
         DateTime firstReportDateTimeWithYear =
           DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
@@ -330,19 +298,16 @@ namespace detail {
                        dateTimes[i].time());
           }
           m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-          m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
         }
       } else {
         m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
         for (unsigned i = 1; i < dateTimes.size(); i++) {
           m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-          m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
         }
       }
 
       for (unsigned i = 1; i < dateTimes.size(); i++) {
-        if (m_secondsFromStart[i] < m_secondsFromStart[i - 1]) {
+        if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
           LOG_AND_THROW("Dates from first report must be monotonically increasing");
         }
       }
@@ -351,12 +316,12 @@ namespace detail {
       if (!extraTime) {
         int delta;
         bool foundInterval = false;
-        if (m_secondsFromStart.size() > 1) {
+        if (m_secondsFromFirstReport.size() > 1) {
           // check if all data is reported at a constant interval
-          delta = m_secondsFromStart[1] - m_secondsFromStart[0];
+          delta = m_secondsFromFirstReport[1] - m_secondsFromFirstReport[0];
           foundInterval = true;
-          for (unsigned i = 2; i < m_secondsFromStart.size(); i++) {
-            if (delta != m_secondsFromStart[i] - m_secondsFromStart[i - 1]) foundInterval = false;
+          for (unsigned i = 2; i < m_secondsFromFirstReport.size(); i++) {
+            if (delta != m_secondsFromFirstReport[i] - m_secondsFromFirstReport[i - 1]) foundInterval = false;
             break;
           }
         }
@@ -375,22 +340,15 @@ namespace detail {
         }
       }
 
-      int firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
-
-      // Compute the seconds from start
-      m_secondsFromStart[0] = firstIntervalSeconds;
-      for (unsigned i = 1; i < dateTimes.size(); i++) {
-        m_secondsFromStart[i] = m_secondsFromStart[i] + firstIntervalSeconds;
-      }
-
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+      // seconds from start are seconds from first report offset by the first interval
+      m_firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
     }
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values,
                                    const std::string& units)
     : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -418,17 +376,13 @@ namespace detail {
                   "the future.");
         m_startDateTime = DateTime(firstReportDateTime.date());
         m_firstReportDateTime = firstReportDateTime;
-        int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
-        m_secondsFromStart = timeInSeconds;
-        for (unsigned i = 0; i < m_secondsFromStart.size(); i++) {
-          m_secondsFromStart[i] += firstIntervalSeconds;
-        }
+        m_firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
         m_secondsFromFirstReport = timeInSeconds;
 
       } else {  // This is the new behavior
         m_startDateTime = firstReportDateTime - Time(0, 0, 0, timeInSeconds[0]);
         m_firstReportDateTime = firstReportDateTime;
-        m_secondsFromStart = timeInSeconds;
+        m_firstIntervalSeconds = timeInSeconds[0];
 
         // Get rid of this later
         m_secondsFromFirstReport[0] = 0;
@@ -438,12 +392,7 @@ namespace detail {
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-    long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
-    }
+    long durationSeconds = this->durationSeconds();
 
     // check for wrap around
     boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
@@ -462,18 +411,18 @@ namespace detail {
   }
 
   DateTimeVector TimeSeries_Impl::dateTimes() const {
-    DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+    DateTimeVector dateTimeObjs(m_values.size());
+    for (unsigned i = 0; i < m_values.size(); i++) {
+      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, secondsFromFirstReportAt(i));
     }
     return dateTimeObjs;
   }
 
   /// time in days from end of the first reporting interval
   Vector TimeSeries_Impl::daysFromFirstReport() const {
-    Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    Vector daysFromFirstReport(m_values.size());
+    for (unsigned i = 0; i < m_values.size(); i++) {
+      daysFromFirstReport[i] = Time(0, 0, 0, secondsFromFirstReportAt(i)).totalDays();
     }
     return daysFromFirstReport;
   }
@@ -481,23 +430,30 @@ namespace detail {
   /// time in days from end of the first reporting interval at index i
   double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const {
     double value = m_outOfRangeValue;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    if (i < m_values.size()) {
+      value = Time(0, 0, 0, secondsFromFirstReportAt(i)).totalDays();
     }
     return value;
   }
 
   /// time in seconds from end of the first reporting interval
   std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const {
-    return m_secondsFromFirstReport;
+    if (!m_intervalLength) {
+      return m_secondsFromFirstReport;
+    }
+    std::vector<long> result(m_values.size());
+    for (unsigned i = 0; i < m_values.size(); i++) {
+      result[i] = secondsFromFirstReportAt(i);
+    }
+    return result;
   }
 
   /// time in seconds from end of the first reporting interval at index i
   long TimeSeries_Impl::secondsFromFirstReport(const unsigned& i) const {
     //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
     long value = 0;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = m_secondsFromFirstReport[i];
+    if (i < m_values.size()) {
+      value = secondsFromFirstReportAt(i);
     }
     return value;
   }
@@ -530,12 +486,12 @@ namespace detail {
   double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstReport) const {
     double result = m_outOfRangeValue;
 
-    if (m_secondsFromFirstReport.empty()) {
+    if (m_values.empty()) {
       LOG(Debug, "Cannot compute value because timeseries is empty");
       return result;
     }
 
-    long duration = m_secondsFromFirstReport.back();
+    long duration = durationSeconds();
 
     if (m_intervalLength) {
 
@@ -581,8 +537,14 @@ namespace detail {
         LOG(Debug,
             "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
       } else {
-        // normal interpolation
-        result = interp(m_secondsFromFirstReportAsVector, m_values, secondsFromFirstReport, HoldNextInterp, NoneExtrap);
+        // hold next value, same as interp with HoldNextInterp: the first report at or after this time,
+        // but the last one if several reports share the final time
+        size_t index = std::lower_bound(m_secondsFromFirstReport.begin(), m_secondsFromFirstReport.end(), secondsFromFirstReport)
+                       - m_secondsFromFirstReport.begin();
+        if ((index > 0) && (secondsFromFirstReport == duration)) {
+          index = m_values.size() - 1;
+        }
+        result = m_values(index);
       }
     }
 
@@ -687,12 +649,13 @@ namespace detail {
     double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
     unsigned numValues = m_values.size();
-    OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+    OS_ASSERT(m_intervalLength || (numValues == m_secondsFromFirstReport.size()));
 
     Vector result(numValues);
     unsigned resultSize = 0;
     for (unsigned i = 0; i < numValues; ++i) {
-      if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) && (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
+      long secondsFromFirstReport = secondsFromFirstReportAt(i);
+      if ((secondsFromFirstReport >= startSecondsFromFirstReport) && (secondsFromFirstReport <= endSecondsFromFirstReport)) {
         result[resultSize] = m_values[i];
         ++resultSize;
       }
@@ -719,77 +682,139 @@ namespace detail {
 
   /// add timeseries
   std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Impl& other) const {
-    std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
-
     // if same units
     if (m_units == other.units()) {
+      return combine(other, 1.0);
+    }
 
-      // make unique, ordered set of all date times
-      std::set<DateTime> dateTimesSet;
-      DateTimeVector dateTimes1 = dateTimes();
-      DateTimeVector dateTimes2 = other.dateTimes();
-      dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-      dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
-
-      // create vector out of set
-      DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+    LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
 
-      // compute value at each date time
-      Vector values(dateTimesSet.size());
-      unsigned valueIndex = 0;
-      for (const DateTime& dt : dateTimes) {
-        values[valueIndex] = value(dt) + other.value(dt);
+  /// subtract timeseries
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Impl& other) const {
+    // if same units
+    if (m_units == other.units()) {
+      return combine(other, -1.0);
+    }
 
-        LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
+    LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
 
-        ++valueIndex;
-      }
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::combine(const TimeSeries_Impl& other, double otherFactor) const {
+    std::shared_ptr<TimeSeries_Impl> result = combineAligned(other, otherFactor);
+    if (result) {
+      return result;
+    }
 
-      // make new result
-      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+    // make unique, ordered vector of all date times by merging both axes
+    DateTimeVector dateTimes1 = dateTimes();
+    DateTimeVector dateTimes2 = other.dateTimes();
+    if (!std::is_sorted(dateTimes1.begin(), dateTimes1.end())) {
+      std::sort(dateTimes1.begin(), dateTimes1.end());
+    }
+    if (!std::is_sorted(dateTimes2.begin(), dateTimes2.end())) {
+      std::sort(dateTimes2.begin(), dateTimes2.end());
+    }
+    DateTimeVector dateTimes;
+    dateTimes.reserve(dateTimes1.size() + dateTimes2.size());
+    std::merge(dateTimes1.begin(), dateTimes1.end(), dateTimes2.begin(), dateTimes2.end(), std::back_inserter(dateTimes));
+    dateTimes.erase(std::unique(dateTimes.begin(), dateTimes.end()), dateTimes.end());
 
+    // compute value at each date time
+    Vector values;
+    if (m_firstReportDateTime.date().baseYear() && other.m_firstReportDateTime.date().baseYear() && !m_wrapAround && !other.m_wrapAround) {
+      values = valuesAt(dateTimes) + otherFactor * other.valuesAt(dateTimes);
     } else {
-      LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+      // without a year, value(dateTime) has to resolve the year of each date time
+      values = Vector(dateTimes.size());
+      for (unsigned i = 0; i < dateTimes.size(); ++i) {
+        values[i] = value(dateTimes[i]) + otherFactor * other.value(dateTimes[i]);
+      }
     }
 
-    return result;
+    // make new result
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
   }
 
-  /// subtract timeseries
-  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Impl& other) const {
-    std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::combineAligned(const TimeSeries_Impl& other, double otherFactor) const {
+    std::shared_ptr<TimeSeries_Impl> result;
 
-    // if same units
-    if (m_units == other.units()) {
+    if (!m_intervalLength || !other.m_intervalLength || m_values.empty() || other.m_values.empty()) {
+      return result;
+    }
+    long interval = m_intervalLength->totalSeconds();
+    if ((interval <= 0) || (interval != other.m_intervalLength->totalSeconds())) {
+      return result;
+    }
+
+    long n1 = m_values.size();
+    long n2 = other.m_values.size();
 
-      // make unique, ordered set of all date times
-      std::set<DateTime> dateTimesSet;
-      DateTimeVector dateTimes1 = dateTimes();
-      DateTimeVector dateTimes2 = other.dateTimes();
-      dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-      dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+    // same axis, plain element-wise combination
+    if ((n1 == n2) && (m_firstReportDateTime == other.m_firstReportDateTime)
+        && (m_firstReportDateTime.date().baseYear() == other.m_firstReportDateTime.date().baseYear()) && (m_wrapAround == other.m_wrapAround)) {
+      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, *m_intervalLength, m_values + otherFactor * other.m_values, m_units));
+      return result;
+    }
 
-      // create vector out of set
-      DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+    // axes shifted by a whole number of intervals, only when both series have a year so date times compare unambiguously
+    if (!m_firstReportDateTime.date().baseYear() || !other.m_firstReportDateTime.date().baseYear() || m_wrapAround || other.m_wrapAround) {
+      return result;
+    }
+    long offsetSeconds = (other.m_firstReportDateTime - m_firstReportDateTime).totalSeconds();
+    if (offsetSeconds % interval != 0) {
+      return result;
+    }
+    long offset = offsetSeconds / interval;
 
-      // compute value at each date time
-      Vector values(dateTimesSet.size());
-      unsigned valueIndex = 0;
-      for (const DateTime& dt : dateTimes) {
-        values[valueIndex] = value(dt) - other.value(dt);
+    // the union of both axes must not have a gap, otherwise it is not regular
+    if ((offset > n1) || (offset < -n2)) {
+      return result;
+    }
 
-        LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
+    long first = std::min(0L, offset);
+    long last = std::max(n1, offset + n2);
+    Vector values(last - first);
+    for (long i = first; i < last; ++i) {
+      double value1 = ((i >= 0) && (i < n1)) ? m_values[i] : m_outOfRangeValue;
+      double value2 = ((i >= offset) && (i < offset + n2)) ? other.m_values[i - offset] : other.m_outOfRangeValue;
+      values[i - first] = value1 + otherFactor * value2;
+    }
 
-        ++valueIndex;
-      }
+    DateTime firstReportDateTime = (offset < 0) ? other.m_firstReportDateTime : m_firstReportDateTime;
+    result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(firstReportDateTime, *m_intervalLength, values, m_units));
+    return result;
+  }
 
-      // make new result
-      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+  Vector TimeSeries_Impl::valuesAt(const DateTimeVector& sortedDateTimes) const {
+    Vector result(sortedDateTimes.size());
 
-    } else {
-      LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+    // regular series are already looked up without a search
+    if (m_intervalLength || m_values.empty()) {
+      for (unsigned i = 0; i < sortedDateTimes.size(); ++i) {
+        result[i] = valueAtSecondsFromFirstReport((sortedDateTimes[i] - m_firstReportDateTime).totalSeconds());
+      }
+      return result;
     }
 
+    // hold next value, same as interp with HoldNextInterp and NoneExtrap in valueAtSecondsFromFirstReport
+    const size_t n = m_secondsFromFirstReport.size();
+    const long duration = m_secondsFromFirstReport.back();
+    size_t index = 0;
+    for (unsigned i = 0; i < sortedDateTimes.size(); ++i) {
+      long seconds = (sortedDateTimes[i] - m_firstReportDateTime).totalSeconds();
+      if ((seconds < 0) || (seconds > duration)) {
+        result[i] = m_outOfRangeValue;
+        continue;
+      }
+      while (m_secondsFromFirstReport[index] < seconds) {
+        ++index;
+      }
+      // several reports at the final time hold the last one, unless the series has no duration where index 0 is the first report
+      result[i] = ((index > 0) && (seconds == duration)) ? m_values[n - 1] : m_values[index];
+    }
     return result;
   }
 
@@ -812,20 +837,35 @@ namespace detail {
       double lastTime = 0;
       // Use a Riemann sum to integrate under the curve
       for (unsigned i = 0; i < m_values.size(); i++) {
-        result += (m_secondsFromStart[i] - lastTime) * m_values[i];
-        lastTime = m_secondsFromStart[i];
+        double secondsFromStart = m_secondsFromFirstReport[i] + m_firstIntervalSeconds;
+        result += (secondsFromStart - lastTime) * m_values[i];
+        lastTime = secondsFromStart;
       }
     }
     return result;
   }
 
   double TimeSeries_Impl::averageValue() const {
-    if (m_secondsFromStart.size() > 0) {
-      return integrate() / m_secondsFromStart.back();
+    if (!m_values.empty()) {
+      return integrate() / (durationSeconds() + m_firstIntervalSeconds);
     }
     return 0;
   }
 
+  long TimeSeries_Impl::secondsFromFirstReportAt(size_t i) const {
+    if (m_intervalLength) {
+      return static_cast<long>(i) * m_intervalLength->totalSeconds();
+    }
+    return m_secondsFromFirstReport[i];
+  }
+
+  long TimeSeries_Impl::durationSeconds() const {
+    if (m_values.empty()) {
+      return 0;
+    }
+    return secondsFromFirstReportAt(m_values.size() - 1);
+  }
+
 }  // namespace detail
 
 TimeSeries::TimeSeries() : m_impl(std::shared_ptr<detail::TimeSeries_Impl>(new detail::TimeSeries_Impl())) {}
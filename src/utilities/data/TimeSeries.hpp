@@ -112,6 +112,22 @@ namespace detail {
 
    private:
     REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+    // this + otherFactor * other, shared by operator+ and operator-
+    std::shared_ptr<TimeSeries_Impl> combine(const TimeSeries_Impl& other, double otherFactor) const;
+
+    // element-wise combination when both series are regular with the same interval and their reports line up,
+    // returns nullptr if the axes do not allow it
+    std::shared_ptr<TimeSeries_Impl> combineAligned(const TimeSeries_Impl& other, double otherFactor) const;
+
+    // values at each of the sorted dateTimes, walking the axis once instead of searching it for each date time
+    Vector valuesAt(const DateTimeVector& sortedDateTimes) const;
+
+    // seconds from first report of value i, computed from the interval length for regular series
+    long secondsFromFirstReportAt(size_t i) const;
+
+    // seconds from first report of the last value, 0 if empty
+    long durationSeconds() const;
     // fully qualified first report date
     DateTime m_firstReportDateTime;
 
@@ -119,9 +135,11 @@ namespace detail {
     DateTime m_startDateTime;
 
     // integer seconds from first report date time, used for quick interpolation
+    // only stored for series without an interval length, regular series compute them from the interval
     std::vector<long> m_secondsFromFirstReport;
-    Vector m_secondsFromFirstReportAsVector;  // same as m_secondsFromFirstReport but stored as Vector
-    std::vector<long> m_secondsFromStart;
+
+    // seconds from start date and time to first report, seconds from start of value i are secondsFromFirstReport(i) + m_firstIntervalSeconds
+    long m_firstIntervalSeconds;
 
     // values reported at m_dateTimes
     Vector m_values;
@@ -37,8 +37,13 @@
 #include "../data/Vector.hpp"
 #include "../time/DateTime.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <iostream>
 
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/regex.hpp>
 
 namespace openstudio {
@@ -446,6 +451,83 @@ boost::optional<CSVFile> CSVFile::load(const openstudio::path& p) {
   return result;
 }
 
+std::vector<double> CSVFile::readColumnAsDoubleVector(const openstudio::path& p, unsigned columnIndex, unsigned rowsToSkip, char separator) {
+  std::vector<double> result;
+
+  if (!boost::filesystem::exists(p) || !boost::filesystem::is_regular_file(p)) {
+    LOG(Error, "Path '" << p << "' is not a CSVFile");
+    return result;
+  }
+  if (boost::filesystem::file_size(p) == 0) {
+    return result;
+  }
+
+  boost::iostreams::mapped_file_source file;
+  try {
+    file.open(p);
+  } catch (const std::exception& e) {
+    LOG(Error, "Cannot map '" << p << "': " << e.what());
+    return result;
+  }
+
+  const char* it = file.data();
+  const char* end = it + file.size();
+
+  // rough guess from the first line
+  const char* firstNewline = std::find(it, end, '\n');
+  result.reserve(file.size() / std::max<std::ptrdiff_t>(1, firstNewline - it + 1));
+
+  std::string cell;
+  unsigned rowIndex = 0;
+  while (it < end) {
+    const char* lineEnd = std::find(it, end, '\n');
+    const char* lineBegin = it;
+    it = (lineEnd == end) ? end : lineEnd + 1;
+
+    if ((lineEnd > lineBegin) && (*(lineEnd - 1) == '\r')) {
+      --lineEnd;
+    }
+    if (rowIndex++ < rowsToSkip) {
+      continue;
+    }
+    if (std::all_of(lineBegin, lineEnd, [](char c) { return std::isspace(static_cast<unsigned char>(c)); })) {
+      continue;
+    }
+
+    // find the requested cell without touching the others
+    const char* cellBegin = lineBegin;
+    for (unsigned i = 0; (i < columnIndex) && (cellBegin != lineEnd); ++i) {
+      cellBegin = std::find(cellBegin, lineEnd, separator);
+      if (cellBegin != lineEnd) {
+        ++cellBegin;
+        if (separator == ' ') {
+          while ((cellBegin != lineEnd) && (*cellBegin == ' ')) {
+            ++cellBegin;
+          }
+        }
+      }
+    }
+    const char* cellEnd = std::find(cellBegin, lineEnd, separator);
+
+    cell.assign(cellBegin, cellEnd);
+    boost::trim(cell);
+    if ((cellBegin == lineEnd) || cell.empty()) {
+      LOG(Warn, "Row " << rowIndex - 1 << " of '" << p << "' has no column " << columnIndex);
+      return std::vector<double>();
+    }
+
+    char* parsedEnd = nullptr;
+    double value = std::strtod(cell.c_str(), &parsedEnd);
+    if (parsedEnd != cell.c_str() + cell.size()) {
+      LOG(Warn, "Value '" << cell << "' at row " << rowIndex - 1 << " and column " << columnIndex << " is not a numeric value");
+      return std::vector<double>();
+    }
+    result.push_back(value);
+  }
+
+  return result;
+}
+
 std::string CSVFile::string() const {
   return getImpl<detail::CSVFile_Impl>()->string();
 }
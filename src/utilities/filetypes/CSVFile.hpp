@@ -68,6 +68,13 @@ class UTILITIES_API CSVFile
   /** Attempt to load a CSVFile from path */
   static boost::optional<CSVFile> load(const openstudio::path& p);
 
+  /** Reads a single column of numbers (first column is index 0) from the delimited text file at p, without loading the
+   *  whole file. The file is memory mapped, rowsToSkip rows are skipped at the top and only the requested cell of each
+   *  remaining row is parsed. Blank rows are ignored; when separator is a space, consecutive spaces count as one. Empty
+   *  vector is returned if the file cannot be read, if any row is too short or if any cell is not a valid number. */
+  static std::vector<double> readColumnAsDoubleVector(const openstudio::path& p, unsigned columnIndex, unsigned rowsToSkip = 0,
+                                                      char separator = ',');
+
   /** Get the CSVFile as a string. */
   std::string string() const;
 
@@ -296,3 +296,27 @@ TEST(Filetypes, CSVFile_AddAndGetColumn) {
   EXPECT_EQ("2.2", getCol4[1]);
   EXPECT_EQ("0.33", getCol4[2]);
 }
+
+TEST(Filetypes, CSVFile_ReadColumnAsDoubleVector) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/TDV_2008_kBtu_CZ13.csv");
+
+  // four header rows, trailing spaces in the natural gas columns
+  std::vector<double> electric = CSVFile::readColumnAsDoubleVector(p, 0, 4);
+  ASSERT_EQ(8760u, electric.size());
+  EXPECT_DOUBLE_EQ(11.64294171, electric[0]);
+  EXPECT_DOUBLE_EQ(16.60602591, electric[8759]);
+
+  std::vector<double> gas = CSVFile::readColumnAsDoubleVector(p, 3, 4, ',');
+  ASSERT_EQ(8760u, gas.size());
+  EXPECT_DOUBLE_EQ(165.73, gas[0]);
+  EXPECT_DOUBLE_EQ(154.50, gas[8759]);
+
+  // header rows are not numeric
+  EXPECT_TRUE(CSVFile::readColumnAsDoubleVector(p, 0, 0).empty());
+
+  // column out of range
+  EXPECT_TRUE(CSVFile::readColumnAsDoubleVector(p, 6, 4).empty());
+
+  // missing file
+  EXPECT_TRUE(CSVFile::readColumnAsDoubleVector(resourcesPath() / toPath("utilities/Filetypes/not_a_file.csv"), 0).empty());
+}
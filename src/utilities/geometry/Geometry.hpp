@@ -92,6 +92,7 @@ UTILITIES_API bool circularEqual(const std::vector<Point3d>& points1, const std:
 
 /// if point3d is within tol of any existing points then returns existing point
 /// otherwise adds point3d to allPoints and returns point3d
+/// this is linear in the size of allPoints, use PointWelder when combining many points
 UTILITIES_API Point3d getCombinedPoint(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001);
 
 /// compute triangulation of vertices, holes are removed in the triangulation
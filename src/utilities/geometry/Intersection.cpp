@@ -30,6 +30,7 @@
 #include "Geometry.hpp"
 #include "Vector3d.hpp"
 #include "Intersection.hpp"
+#include "PointWelder.hpp"
 #include "../data/Matrix.hpp"
 #include "../core/Assert.hpp"
 #include "../core/Logger.hpp"
@@ -49,6 +50,7 @@
 #include <boost/geometry/strategies/cartesian/point_in_poly_crossings_multiply.hpp>
 #include <boost/geometry/algorithms/within.hpp>
 #include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #if defined(_MSC_VER)
 #  pragma warning(pop)
 #endif
@@ -58,6 +60,7 @@ typedef boost::geometry::model::d2::point_xy<double> BoostPoint;
 typedef boost::geometry::model::polygon<BoostPoint> BoostPolygon;
 typedef boost::geometry::model::ring<BoostPoint> BoostRing;
 typedef boost::geometry::model::multi_polygon<BoostPolygon> BoostMultiPolygon;
+typedef boost::geometry::model::box<BoostPoint> BoostBox;
 
 #include <polypartition/polypartition.h>
 
@@ -220,20 +223,20 @@ std::vector<BoostPolygon> removeHoles(const std::vector<BoostPolygon>& polygons)
 }
 
 // convert a Point3d to a BoostPoint
-boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) {
+boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, PointWelder& allPoints, double tol) {
   OS_ASSERT(abs(point3d.z()) <= tol);
 
   // simple method
   //return boost::make_tuple(point3d.x(), point3d.y());
 
   // detailed method, try to combine points within tolerance
-  Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+  Point3d resultPoint = allPoints.weld(point3d);
 
   return boost::make_tuple(resultPoint.x(), resultPoint.y());
 }
 
 // convert vertices to a boost polygon, all vertices must lie on z = 0 plane
-boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, PointWelder& allPoints, double tol) {
   if (vertices.size() < 3) {
     return boost::none;
   }
@@ -266,7 +269,7 @@ boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d
   return polygon;
 }
 
-boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints,
+boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, PointWelder& allPoints,
                                                                       double tol) {
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> result = boostPolygonFromVertices(polygon, allPoints, tol);
@@ -284,7 +287,7 @@ boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std:
 }
 
 // convert vertices to a boost ring, all vertices must lie on z = 0 plane
-boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, PointWelder& allPoints, double tol) {
   if (vertices.size() < 3) {
     return boost::none;
   }
@@ -317,7 +320,7 @@ boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& ver
   return ring;
 }
 
-boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, PointWelder& allPoints, double tol) {
   boost::optional<BoostRing> result = boostRingFromVertices(polygon, allPoints, tol);
   if (!result) {
     return boost::none;
@@ -333,7 +336,7 @@ boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vecto
 }
 
 // convert a boost polygon to vertices
-std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::vector<Point3d>& allPoints, double tol) {
+std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, PointWelder& allPoints) {
   std::vector<Point3d> result;
 
   BoostRing outer = polygon.outer();
@@ -346,7 +349,7 @@ std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::
     Point3d point3d(outer[i].x(), outer[i].y(), 0.0);
 
     // try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.weld(point3d);
 
     // don't keep repeated vertices
     if ((i > 0) && (result.back() == resultPoint)) {
@@ -375,7 +378,7 @@ std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::
 }
 
 // convert a boost ring to vertices
-std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Point3d>& allPoints, double tol) {
+std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, PointWelder& allPoints) {
   std::vector<Point3d> result;
 
   // add point for each vertex except final vertex
@@ -383,7 +386,7 @@ std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Po
     Point3d point3d(ring[i].x(), ring[i].y(), 0.0);
 
     // try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.weld(point3d);
 
     // don't keep repeated vertices
     if ((i > 0) && (result.back() == resultPoint)) {
@@ -490,7 +493,7 @@ double IntersectionResult::area2() const {
 
 std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> boostPolygon = boostPolygonFromVertices(polygon, allPoints, tol);
@@ -500,14 +503,14 @@ std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double to
 
   BoostPolygon boostResult = removeSpikes(*boostPolygon);
 
-  std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, allPoints, tol);
+  std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, allPoints);
 
   return result;
 }
 
 bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, allPoints, tol);
   if (!boostPolygon) {
@@ -538,7 +541,7 @@ bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, d
 
 boost::optional<std::vector<Point3d>> join(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
   if (!boostPolygon1) {
@@ -574,7 +577,7 @@ boost::optional<std::vector<Point3d>> join(const std::vector<Point3d>& polygon1,
     return boost::none;
   };
 
-  std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], allPoints, tol);
+  std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], allPoints);
   boost::optional<double> testArea = boost::geometry::area(unionResult[0]);
   if (!testArea || unionVertices.empty()) {
     LOG_FREE(Info, "utilities.geometry.join", "Cannot compute area of union");
@@ -597,6 +600,170 @@ boost::optional<std::vector<Point3d>> join(const std::vector<Point3d>& polygon1,
   return unionVertices;
 }
 
+// 2D bounding box of vertices on the z = 0 plane, grown by tol so that touching polygons overlap
+BoostBox boostBoxFromVertices(const std::vector<Point3d>& vertices, double tol) {
+  BoostBox box;
+  boost::geometry::assign_inverse(box);
+  for (const Point3d& vertex : vertices) {
+    boost::geometry::expand(box, BoostPoint(vertex.x(), vertex.y()));
+  }
+  if (!vertices.empty()) {
+    box.min_corner().x(box.min_corner().x() - tol);
+    box.min_corner().y(box.min_corner().y() - tol);
+    box.max_corner().x(box.max_corner().x() + tol);
+    box.max_corner().y(box.max_corner().y() + tol);
+  }
+  return box;
+}
+
+// Groups polygons that are connected through joinable pairs, same as findConnectedComponents on the adjacency matrix.
+// Only pairs whose bounding boxes overlap in an R-tree are tested with canJoin, pairs already in the same group are skipped.
+// Groups are ordered by their lowest index and indices within a group are ascending.
+template <typename CanJoin>
+std::vector<std::vector<unsigned>> findJoinableGroups(const std::vector<BoostBox>& boxes, CanJoin canJoin) {
+  const unsigned N = static_cast<unsigned>(boxes.size());
+
+  std::vector<std::pair<BoostBox, unsigned>> values;
+  values.reserve(N);
+  for (unsigned i = 0; i < N; ++i) {
+    values.emplace_back(boxes[i], i);
+  }
+  // packing constructor, bulk loads the tree
+  boost::geometry::index::rtree<std::pair<BoostBox, unsigned>, boost::geometry::index::rstar<16>> rtree(values.begin(), values.end());
+
+  // union-find with path halving
+  std::vector<unsigned> parent(N);
+  for (unsigned i = 0; i < N; ++i) {
+    parent[i] = i;
+  }
+  auto find = [&parent](unsigned i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+
+  std::vector<std::pair<BoostBox, unsigned>> candidates;
+  for (unsigned i = 0; i < N; ++i) {
+    candidates.clear();
+    rtree.query(boost::geometry::index::intersects(boxes[i]), std::back_inserter(candidates));
+
+    // test in index order so results do not depend on the tree layout
+    std::sort(candidates.begin(), candidates.end(),
+              [](const std::pair<BoostBox, unsigned>& a, const std::pair<BoostBox, unsigned>& b) { return a.second < b.second; });
+    for (const auto& candidate : candidates) {
+      unsigned j = candidate.second;
+      if (j <= i) {
+        continue;
+      }
+      unsigned rootI = find(i);
+      unsigned rootJ = find(j);
+      if (rootI == rootJ) {
+        continue;
+      }
+      if (canJoin(i, j)) {
+        parent[std::max(rootI, rootJ)] = std::min(rootI, rootJ);
+      }
+    }
+  }
+
+  std::vector<std::vector<unsigned>> result;
+  std::vector<size_t> groupIndex(N, N);
+  for (unsigned i = 0; i < N; ++i) {
+    unsigned root = find(i);
+    if (groupIndex[root] == N) {
+      groupIndex[root] = result.size();
+      result.push_back({i});
+    } else {
+      result[groupIndex[root]].push_back(i);
+    }
+  }
+
+  return result;
+}
+
+// Unions a group of polygons at once by reducing pairwise in a balanced tree.
+// Returns none if boost throws or if the union is not a single polygon after removing spikes.
+boost::optional<BoostPolygon> unionAll(const std::vector<BoostPolygon>& polygons) {
+  if (polygons.empty()) {
+    return boost::none;
+  }
+
+  std::vector<BoostMultiPolygon> parts;
+  parts.reserve(polygons.size());
+  for (const BoostPolygon& polygon : polygons) {
+    BoostMultiPolygon part;
+    part.push_back(polygon);
+    parts.push_back(part);
+  }
+
+  try {
+    while (parts.size() > 1) {
+      std::vector<BoostMultiPolygon> merged;
+      merged.reserve((parts.size() + 1) / 2);
+      for (size_t i = 0; i + 1 < parts.size(); i += 2) {
+        BoostMultiPolygon unionResult;
+        boost::geometry::union_(parts[i], parts[i + 1], unionResult);
+        merged.push_back(unionResult);
+      }
+      if (parts.size() % 2 == 1) {
+        merged.push_back(parts.back());
+      }
+      parts.swap(merged);
+    }
+  } catch (const boost::geometry::overlay_invalid_input_exception&) {
+    LOG_FREE(Error, "utilities.geometry.unionAll", "overlay_invalid_input_exception");
+    return boost::none;
+  }
+
+  std::vector<BoostPolygon> unionResult = removeSpikes(std::vector<BoostPolygon>(parts[0].begin(), parts[0].end()));
+  if (unionResult.size() != 1) {
+    return boost::none;
+  }
+
+  return unionResult[0];
+}
+
+// Joins a connected group of polygons with a single union, returns none if the result would differ from joining them one at a time
+boost::optional<std::vector<Point3d>> joinGroup(const std::vector<std::vector<Point3d>>& polygons, const std::vector<unsigned>& group, double tol) {
+  PointWelder allPoints(tol);
+
+  std::vector<BoostPolygon> boostPolygons;
+  boostPolygons.reserve(group.size());
+  for (unsigned i : group) {
+    boost::optional<BoostRing> ring = nonIntersectingBoostRingFromVertices(polygons[i], allPoints, tol);
+    if (!ring) {
+      return boost::none;
+    }
+    BoostPolygon boostPolygon;
+    boostPolygon.outer() = *ring;
+    boostPolygons.push_back(boostPolygon);
+  }
+
+  boost::optional<BoostPolygon> unionResult = unionAll(boostPolygons);
+  if (!unionResult || !unionResult->inners().empty()) {
+    return boost::none;
+  }
+
+  std::vector<Point3d> unionVertices = verticesFromBoostPolygon(*unionResult, allPoints);
+  double testArea = boost::geometry::area(*unionResult);
+  if (unionVertices.empty() || testArea < tol * tol) {
+    return boost::none;
+  }
+
+  try {
+    boost::geometry::detail::overlay::has_self_intersections(*unionResult);
+  } catch (const boost::geometry::overlay_invalid_input_exception&) {
+    return boost::none;
+  }
+
+  unionVertices = reorderULC(unionVertices);
+  unionVertices = removeCollinearLegacy(unionVertices);
+
+  return unionVertices;
+}
+
 std::vector<std::vector<Point3d>> joinAll(const std::vector<std::vector<Point3d>>& polygons, double tol) {
   std::vector<std::vector<Point3d>> result;
 
@@ -613,20 +780,27 @@ std::vector<std::vector<Point3d>> joinAll(const std::vector<std::vector<Point3d>
     }
   }
 
-  // compute adjacency matrix
-  Matrix A(N, N, 0.0);
-  for (unsigned i = 0; i < N; ++i) {
-    A(i, i) = 1.0;
-    for (unsigned j = i + 1; j < N; ++j) {
-      if (join(polygons[i], polygons[j], tol)) {
-        A(i, j) = 1.0;
-        A(j, i) = 1.0;
-      }
-    }
+  // find connected components, only testing polygons whose bounding boxes overlap
+  std::vector<BoostBox> boxes;
+  boxes.reserve(N);
+  for (const auto& polygon : polygons) {
+    boxes.push_back(boostBoxFromVertices(polygon, tol));
   }
 
-  std::vector<std::vector<unsigned>> connectedComponents = findConnectedComponents(A);
+  std::vector<std::vector<unsigned>> connectedComponents =
+    findJoinableGroups(boxes, [&polygons, tol](unsigned i, unsigned j) { return static_cast<bool>(join(polygons[i], polygons[j], tol)); });
   for (const std::vector<unsigned>& component : connectedComponents) {
+    if (component.size() == 1) {
+      result.push_back(polygons[component[0]]);
+      continue;
+    }
+
+    // try to union the whole component at once, fall back to joining one polygon at a time
+    if (boost::optional<std::vector<Point3d>> joined = joinGroup(polygons, component, tol)) {
+      result.push_back(*joined);
+      continue;
+    }
+
     std::vector<unsigned> orderedComponent(component);
     std::sort(orderedComponent.begin(), orderedComponent.end(), [&polygonAreas](int ia, int ib) { return polygonAreas[ia] > polygonAreas[ib]; });
 
@@ -678,7 +852,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   //std::cout << "Initial polygon2 area " << getArea(polygon2).get() << '\n';
 
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
   if (!boostPolygon1) {
@@ -715,7 +889,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   }
 
   // check that largest intersection is ok
-  std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], allPoints, tol);
+  std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], allPoints);
   boost::optional<double> testArea = boost::geometry::area(intersectionResult[0]);
   if (!testArea || intersectionVertices.empty()) {
     LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of largest intersection");
@@ -742,7 +916,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   // create new polygon for each remaining intersection
   for (unsigned i = 1; i < intersectionResult.size(); ++i) {
 
-    std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], allPoints, tol);
+    std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], allPoints);
 
     testArea = boost::geometry::area(intersectionResult[i]);
     if (!testArea || newPolygon.empty()) {
@@ -777,7 +951,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   // create new polygon for each difference
   for (unsigned i = 0; i < differenceResult1.size(); ++i) {
 
-    std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(differenceResult1[i], allPoints, tol);
+    std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(differenceResult1[i], allPoints);
 
     testArea = boost::geometry::area(differenceResult1[i]);
     if (!testArea || newPolygon1.empty()) {
@@ -807,7 +981,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   // create new polygon for each difference
   for (unsigned i = 0; i < differenceResult2.size(); ++i) {
 
-    std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(differenceResult2[i], allPoints, tol);
+    std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(differenceResult2[i], allPoints);
 
     testArea = boost::geometry::area(differenceResult2[i]);
     if (!testArea || newPolygon2.empty()) {
@@ -840,7 +1014,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
   std::vector<std::vector<Point3d>> result;
 
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> initialBoostPolygon = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
@@ -873,7 +1047,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
   }
 
   for (const BoostPolygon& boostPolygon : boostPolygons) {
-    result.push_back(verticesFromBoostPolygon(boostPolygon, allPoints, tol));
+    result.push_back(verticesFromBoostPolygon(boostPolygon, allPoints));
   }
 
   return result;
@@ -881,7 +1055,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
 
 bool selfIntersects(const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> bp = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
@@ -894,7 +1068,7 @@ bool selfIntersects(const std::vector<Point3d>& polygon, double tol) {
 
 bool intersects(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(polygon1, allPoints, tol);
   boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
@@ -914,7 +1088,7 @@ bool within(const Point3d& point1, const std::vector<Point3d>& polygon2, double
 
 bool within(const std::vector<Point3d>& geometry1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   if (geometry1.size() == 1) {
     if (geometry1[0].z() > tol) {
@@ -1001,7 +1175,7 @@ boost::optional<double> getLinearAlpha(const Point3d& point0, const Point3d& poi
 }
 
 std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeCollinear, double tol) {
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   bool reversed = false;
   boost::optional<Vector3d> outwardNormal = getOutwardNormal(vertices);
@@ -1031,7 +1205,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
   //boost::geometry::simplify(*bp, out, 0.0);
   boost::geometry::simplify(*bp, out, tol);  // points within tol would already be merged
 
-  std::vector<Point3d> tmp = verticesFromBoostPolygon(out, allPoints, tol);
+  std::vector<Point3d> tmp = verticesFromBoostPolygon(out, allPoints);
 
   if (reversed) {
     tmp = reorderULC(reverse(tmp));
@@ -1049,11 +1223,12 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
   }
 
   // we want to add back in all the unique points, have to put them in the right place
+  const std::vector<Point3d>& uniquePoints = allPoints.points();
   std::set<size_t> pointsToAdd;
-  for (size_t i = 0; i < allPoints.size(); ++i) {
+  for (size_t i = 0; i < uniquePoints.size(); ++i) {
     bool found = false;
     for (const auto& tmpPoint : tmp) {
-      if (getDistance(tmpPoint, allPoints[i]) < tol) {
+      if (getDistance(tmpPoint, uniquePoints[i]) < tol) {
         found = true;
       }
     }
@@ -1068,7 +1243,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
     // see which remaining points fit in this segment, double is index in allPoints, alpha along line
     std::vector<std::pair<size_t, double>> pointsInSegment;
     for (size_t j : pointsToAdd) {
-      boost::optional<double> alpha = getLinearAlpha(tmp[i - 1], tmp[i], allPoints[j]);
+      boost::optional<double> alpha = getLinearAlpha(tmp[i - 1], tmp[i], uniquePoints[j]);
       if (alpha) {
         pointsInSegment.push_back(std::make_pair(j, *alpha));
       }
@@ -1078,7 +1253,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
               [](std::pair<size_t, double> a, std::pair<size_t, double> b) { return a.second < b.second; });
 
     for (const auto& pointInSegment : pointsInSegment) {
-      result.push_back(allPoints[pointInSegment.first]);
+      result.push_back(uniquePoints[pointInSegment.first]);
       pointsToAdd.erase(pointInSegment.first);
     }
 
@@ -1089,7 +1264,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
   // now check between last point and first point
   std::vector<std::pair<size_t, double>> pointsInSegment;
   for (size_t j : pointsToAdd) {
-    boost::optional<double> alpha = getLinearAlpha(tmp[tmp.size() - 1], tmp[0], allPoints[j]);
+    boost::optional<double> alpha = getLinearAlpha(tmp[tmp.size() - 1], tmp[0], uniquePoints[j]);
     if (alpha) {
       pointsInSegment.push_back(std::make_pair(j, *alpha));
     }
@@ -1099,7 +1274,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
             [](std::pair<size_t, double> a, std::pair<size_t, double> b) { return a.second < b.second; });
 
   for (const auto& pointInSegment : pointsInSegment) {
-    result.push_back(allPoints[pointInSegment.first]);
+    result.push_back(uniquePoints[pointInSegment.first]);
     pointsToAdd.erase(pointInSegment.first);
   }
 
@@ -1111,7 +1286,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
 }
 
 /// Converts a Polygon to a BoostPolygon
-boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon, Point3dVector& allPoints, double tol) {
+boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon, PointWelder& allPoints, double tol) {
   BoostPolygon boostPolygon;
 
   for (const Point3d& vertex : polygon.getOuterPath()) {
@@ -1132,7 +1307,7 @@ boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon,
   return boostPolygon;
 }
 
-Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVector& allPoints, double tol) {
+Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, PointWelder& allPoints) {
   Polygon3d p;
   BoostRing outer = boostPolygon.outer();
   if (outer.empty()) {
@@ -1142,7 +1317,7 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
   Point3dVector points;
   for (unsigned i = 0; i < outer.size() - 1; ++i) {
     Point3d point3d(outer[i].x(), outer[i].y(), 0.0);
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.weld(point3d);
     // don't keep repeated vertices
     if ((i > 0) && (points.back() == resultPoint)) {
       continue;
@@ -1159,7 +1334,7 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
     Point3dVector hole;
     for (unsigned i = 0; i < inner.size() - 1; ++i) {
       Point3d point3d(inner[i].x(), inner[i].y(), 0.0);
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = allPoints.weld(point3d);
       // don't keep repeated vertices
       if ((i > 0) && (hole.back() == resultPoint)) {
         continue;
@@ -1174,9 +1349,11 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
 
 // Non class member stuff
 boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& polygon2) {
-  Point3dVector allPoints;
+  return join(polygon1, polygon2, 0.01);
+}
 
-  double tol = 0.01;
+boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& polygon2, double tol) {
+  PointWelder allPoints(tol);
 
   // Convert polygons to boost polygon (not ring obvs)
   boost::optional<BoostPolygon> boostPolygon1 = BoostPolygonFromPolygon(polygon1, allPoints, tol);
@@ -1208,7 +1385,7 @@ boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& poly
   }
 
   // Convert back to polygon
-  Polygon3d p = PolygonFromBoostPolygon(unionResult.front(), allPoints, tol);
+  Polygon3d p = PolygonFromBoostPolygon(unionResult.front(), allPoints);
   return p;
 }
 
@@ -1227,6 +1404,28 @@ std::vector<Polygon3d> joinAllPolygons(const std::vector<std::vector<Point3d>>&
   return joinAll(inputPolygons, tol);
 }
 
+// Joins a connected group of polygons with a single union, returns none if the union is not a single polygon
+boost::optional<Polygon3d> joinGroup(const std::vector<Polygon3d>& polygons, const std::vector<unsigned>& group, double tol) {
+  PointWelder allPoints(tol);
+
+  std::vector<BoostPolygon> boostPolygons;
+  boostPolygons.reserve(group.size());
+  for (unsigned i : group) {
+    boost::optional<BoostPolygon> boostPolygon = BoostPolygonFromPolygon(polygons[i], allPoints, tol);
+    if (!boostPolygon) {
+      return boost::none;
+    }
+    boostPolygons.push_back(*boostPolygon);
+  }
+
+  boost::optional<BoostPolygon> unionResult = unionAll(boostPolygons);
+  if (!unionResult) {
+    return boost::none;
+  }
+
+  return PolygonFromBoostPolygon(*unionResult, allPoints);
+}
+
 std::vector<Polygon3d> joinAll(const std::vector<Polygon3d>& polygons, double tol) {
 
   std::vector<Polygon3d> result;
@@ -1244,20 +1443,26 @@ std::vector<Polygon3d> joinAll(const std::vector<Polygon3d>& polygons, double to
     }
   }
 
-  // compute adjacency matrix
-  Matrix A(N, N, 0.0);
-  for (unsigned i = 0; i < N; ++i) {
-    A(i, i) = 1.0;
-    for (unsigned j = i + 1; j < N; ++j) {
-      if (join(polygons[i], polygons[j] /*,tol*/)) {
-        A(i, j) = 1.0;
-        A(j, i) = 1.0;
-      }
-    }
+  // find connected components, only testing polygons whose bounding boxes overlap
+  std::vector<BoostBox> boxes;
+  boxes.reserve(N);
+  for (const auto& polygon : polygons) {
+    boxes.push_back(boostBoxFromVertices(polygon.getOuterPath(), tol));
   }
 
-  std::vector<std::vector<unsigned>> connectedComponents = findConnectedComponents(A);
+  std::vector<std::vector<unsigned>> connectedComponents =
+    findJoinableGroups(boxes, [&polygons, tol](unsigned i, unsigned j) { return static_cast<bool>(join(polygons[i], polygons[j], tol)); });
   for (const std::vector<unsigned>& component : connectedComponents) {
+    if (component.size() == 1) {
+      result.push_back(polygons[component[0]]);
+      continue;
+    }
+
+    // try to union the whole component at once, fall back to joining one polygon at a time
+    if (boost::optional<Polygon3d> joined = joinGroup(polygons, component, tol)) {
+      result.push_back(*joined);
+      continue;
+    }
 
     std::vector<unsigned> orderedComponent(component);
     std::sort(orderedComponent.begin(), orderedComponent.end(), [&polygonAreas](int ia, int ib) { return polygonAreas[ia] > polygonAreas[ib]; });
@@ -1275,7 +1480,7 @@ std::vector<Polygon3d> joinAll(const std::vector<Polygon3d>& polygons, double to
         } else {
           // if not already joined
           if (joinedComponents.find(i) == joinedComponents.end()) {
-            boost::optional<Polygon3d> joined = join(polygon, polygons[i] /*, tol*/);
+            boost::optional<Polygon3d> joined = join(polygon, polygons[i], tol);
             if (joined) {
               polygon = *joined;
               joinedComponents.insert(i);
@@ -1301,7 +1506,7 @@ std::vector<Polygon3d> joinAll(const std::vector<Polygon3d>& polygons, double to
 
 std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double tol) {
   BoostMultiPolygon source;
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   for (const Polygon3d& polygon : polygons) {
     // cppcheck-suppress constStatement
@@ -1325,7 +1530,7 @@ std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double
   for (const auto& boostPolygon : resultShrink) {
     BoostPolygon simplified;
     boost::geometry::simplify(boostPolygon, simplified, tol);
-    auto polygon = PolygonFromBoostPolygon(simplified, allPoints, tol);
+    auto polygon = PolygonFromBoostPolygon(simplified, allPoints);
     result.push_back(polygon);
   }
 
@@ -1334,7 +1539,7 @@ std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double
 
 boost::optional<std::vector<Point3d>> buffer(const std::vector<Point3d>& polygon1, double amount, double tol) {
 
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
   boost::optional<BoostPolygon> boostPolygon1 = nonIntersectingBoostPolygonFromVertices(polygon1, allPoints, tol);
 
   if (!boostPolygon1) {
@@ -1356,12 +1561,12 @@ boost::optional<std::vector<Point3d>> buffer(const std::vector<Point3d>& polygon
 
   boost::geometry::buffer(polygons, result, distance_strategy, side_strategy, join_strategy, end_strategy, point_strategy);
 
-  std::vector<Point3d> vertices = verticesFromBoostPolygon(result[0], allPoints, tol);
+  std::vector<Point3d> vertices = verticesFromBoostPolygon(result[0], allPoints);
   return vertices;
 }
 
 boost::optional<std::vector<std::vector<Point3d>>> buffer(const std::vector<std::vector<Point3d>>& polygons, double amount, double tol) {
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   BoostMultiPolygon boostPolygons;
   for (const auto& polygon : polygons) {
@@ -1384,7 +1589,7 @@ boost::optional<std::vector<std::vector<Point3d>>> buffer(const std::vector<std:
 
   std::vector<Point3dVector> results;
   for (const auto& boostPolygon : result) {
-    std::vector<Point3d> points = verticesFromBoostPolygon(boostPolygon, allPoints, tol);
+    std::vector<Point3d> points = verticesFromBoostPolygon(boostPolygon, allPoints);
     results.push_back(points);
   }
   return results;
@@ -1413,19 +1618,15 @@ std::vector<std::vector<Point3d>> joinAllWithBuffer(const std::vector<std::vecto
     modifiedPolygons.push_back(*buffer(polygons[i], offset, tol));
   }
 
-  // compute adjacency matrix
-  Matrix A(N, N, 0.0);
-  for (unsigned i = 0; i < N; ++i) {
-    A(i, i) = 1.0;
-    for (unsigned j = i + 1; j < N; ++j) {
-      if (join(modifiedPolygons[i], modifiedPolygons[j], tol)) {
-        A(i, j) = 1.0;
-        A(j, i) = 1.0;
-      }
-    }
+  // find connected components, only testing polygons whose bounding boxes overlap
+  std::vector<BoostBox> boxes;
+  boxes.reserve(N);
+  for (const auto& polygon : modifiedPolygons) {
+    boxes.push_back(boostBoxFromVertices(polygon, tol));
   }
 
-  std::vector<std::vector<unsigned>> connectedComponents = findConnectedComponents(A);
+  std::vector<std::vector<unsigned>> connectedComponents = findJoinableGroups(
+    boxes, [&modifiedPolygons, tol](unsigned i, unsigned j) { return static_cast<bool>(join(modifiedPolygons[i], modifiedPolygons[j], tol)); });
   for (const std::vector<unsigned>& component : connectedComponents) {
     std::vector<unsigned> orderedComponent(component);
     std::sort(orderedComponent.begin(), orderedComponent.end(), [&polygonAreas](int ia, int ib) { return polygonAreas[ia] > polygonAreas[ib]; });
@@ -82,6 +82,9 @@ UTILITIES_API boost::optional<std::vector<Point3d>> join(const std::vector<Point
 
 UTILITIES_API boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& polygon2);
 
+/// compute the union of two overlapping polygons, points within tol are combined
+UTILITIES_API boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& polygon2, double tol);
+
 /// compute the union of many polygons, requires that all vertices are in clockwise order on the z = 0 plane (i.e. in face coordinates but reversed)
 UTILITIES_API std::vector<std::vector<Point3d>> joinAll(const std::vector<std::vector<Point3d>>& polygons, double tol);
 
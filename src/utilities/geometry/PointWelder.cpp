@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PointWelder.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <cmath>
+
+namespace openstudio {
+
+PointWelder::PointWelder(double tol) : m_tol(tol), m_cellSize(tol > 0.0 ? tol : 1.0) {}
+
+Point3d PointWelder::weld(const Point3d& point3d) {
+  return m_points[weldIndex(point3d)];
+}
+
+size_t PointWelder::weldIndex(const Point3d& point3d) {
+  const CellKey key = cellKey(point3d);
+
+  // any point closer than tol is at most one cell away, keep the earliest one to match getCombinedPoint
+  size_t result = m_points.size();
+  for (std::int64_t i = -1; i <= 1; ++i) {
+    for (std::int64_t j = -1; j <= 1; ++j) {
+      for (std::int64_t k = -1; k <= 1; ++k) {
+        auto it = m_cells.find(CellKey{key[0] + i, key[1] + j, key[2] + k});
+        if (it == m_cells.end()) {
+          continue;
+        }
+        for (size_t index : it->second) {
+          if (index >= result) {
+            break;
+          }
+          const Point3d& otherPoint = m_points[index];
+          if (std::sqrt(std::pow(point3d.x() - otherPoint.x(), 2) + std::pow(point3d.y() - otherPoint.y(), 2)
+                        + std::pow(point3d.z() - otherPoint.z(), 2))
+              < m_tol) {
+            result = index;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  if (result == m_points.size()) {
+    m_points.push_back(point3d);
+    m_cells[key].push_back(result);
+  }
+
+  return result;
+}
+
+const std::vector<Point3d>& PointWelder::points() const {
+  return m_points;
+}
+
+double PointWelder::tolerance() const {
+  return m_tol;
+}
+
+size_t PointWelder::CellKeyHash::operator()(const CellKey& key) const {
+  return boost::hash_range(key.begin(), key.end());
+}
+
+PointWelder::CellKey PointWelder::cellKey(const Point3d& point3d) const {
+  return CellKey{static_cast<std::int64_t>(std::floor(point3d.x() / m_cellSize)), static_cast<std::int64_t>(std::floor(point3d.y() / m_cellSize)),
+                 static_cast<std::int64_t>(std::floor(point3d.z() / m_cellSize))};
+}
+
+}  // namespace openstudio
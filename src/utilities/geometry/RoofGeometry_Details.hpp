@@ -34,6 +34,8 @@
 #include <boost/optional.hpp>
 #include <boost/math/constants/constants.hpp>
 
+#include <algorithm>
+
 namespace openstudio {
 constexpr double EPSILON = 1E-10;
 
@@ -665,19 +667,55 @@ class QueueEvent
     }
   }
 
-  struct Comparer
-  {
-    bool operator()(std::shared_ptr<QueueEvent> q1, std::shared_ptr<QueueEvent> q2) const {
-      return *q1 < *q2;
-    }
-  };
+ private:
+  REGISTER_LOGGER("utilities.QueueEvent");
+};
+
+class EventQueue  // Binary heap of queue events, closest event on top
+{
+ public:
+  void push(std::shared_ptr<QueueEvent> event) {
+    m_heap.push_back(Entry{std::move(event), m_sequence++});
+    std::push_heap(m_heap.begin(), m_heap.end(), Later());
+  }
+
+  const std::shared_ptr<QueueEvent>& top() const {
+    return m_heap.front().event;
+  }
+
+  void pop() {
+    std::pop_heap(m_heap.begin(), m_heap.end(), Later());
+    m_heap.pop_back();
+  }
+
+  bool empty() const {
+    return m_heap.empty();
+  }
 
-  static void insert_sorted(std::vector<std::shared_ptr<QueueEvent>>& queue, std::shared_ptr<QueueEvent> item) {
-    queue.insert(std::upper_bound(queue.begin(), queue.end(), item, QueueEvent::Comparer()), item);
+  size_t size() const {
+    return m_heap.size();
   }
 
  private:
-  REGISTER_LOGGER("utilities.QueueEvent");
+  struct Entry
+  {
+    std::shared_ptr<QueueEvent> event;
+    size_t sequence;
+  };
+
+  // events with equal distance come out in the order they were pushed
+  struct Later
+  {
+    bool operator()(const Entry& e1, const Entry& e2) const {
+      if (e1.event->distance != e2.event->distance) {
+        return e1.event->distance > e2.event->distance;
+      }
+      return e1.sequence > e2.sequence;
+    }
+  };
+
+  std::vector<Entry> m_heap;
+  size_t m_sequence = 0;
 };
 
 class Chain  // Chains of queue events
@@ -1282,7 +1320,7 @@ static std::vector<SplitCandidate> calcOppositeEdges(std::shared_ptr<Vertex> ver
 }
 
 static void computeSplitEvents(std::shared_ptr<Vertex> vertex, const std::vector<std::shared_ptr<Edge>>& edges,
-                               std::vector<std::shared_ptr<QueueEvent>>& queue, boost::optional<double> distanceSquared) {
+                               EventQueue& queue, boost::optional<double> distanceSquared) {
   Point3d source = vertex->point;
 
   std::vector<SplitCandidate> oppositeEdges = calcOppositeEdges(vertex, edges);
@@ -1310,12 +1348,12 @@ static void computeSplitEvents(std::shared_ptr<Vertex> vertex, const std::vector
       // some of vertex event can share the same opposite
       // point
       std::shared_ptr<QueueEvent> e1(new QueueEvent(oppositeEdge.point, oppositeEdge.distance, vertex));  // SplitEvent
-      QueueEvent::insert_sorted(queue, e1);
+      queue.push(e1);
       continue;
     }
 
     std::shared_ptr<QueueEvent> e2(new QueueEvent(oppositeEdge.point, oppositeEdge.distance, vertex, oppositeEdge.oppositeEdge));  // SplitVertexEvent
-    QueueEvent::insert_sorted(queue, e2);
+    queue.push(e2);
     continue;
   }
 }
@@ -1347,15 +1385,15 @@ static std::shared_ptr<QueueEvent> createEdgeEvent(const Point3d& point, std::sh
 }
 
 static void computeEdgeEvents(std::shared_ptr<Vertex> previousVertex, std::shared_ptr<Vertex> nextVertex,
-                              std::vector<std::shared_ptr<QueueEvent>>& queue) {
+                              EventQueue& queue) {
   boost::optional<Point3d> point = computeIntersectionBisectors(previousVertex, nextVertex);
   if (point) {
     std::shared_ptr<QueueEvent> e(createEdgeEvent(point.get(), previousVertex, nextVertex));
-    QueueEvent::insert_sorted(queue, e);
+    queue.push(e);
   }
 }
 
-static void initEvents(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void initEvents(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                        const std::vector<std::shared_ptr<Edge>>& edges) {
   for (std::vector<std::shared_ptr<Vertex>>& lav : sLav) {
     for (std::shared_ptr<Vertex> vertex : lav) {
@@ -1429,7 +1467,7 @@ static int assertMaxNumberOfIterations(int count) {
   return count;
 }
 
-static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(std::vector<std::shared_ptr<QueueEvent>>& queue) {
+static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(EventQueue& queue) {
   /*
   * Loads all non obsolete events which are on one level.
   */
@@ -1437,9 +1475,9 @@ static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(std::vector<std:
   std::vector<std::shared_ptr<QueueEvent>> level;
 
   std::shared_ptr<QueueEvent> levelStart = nullptr;
-  while (queue.size() > 0) {
-    levelStart = queue[0];
-    queue.erase(queue.begin());
+  while (!queue.empty()) {
+    levelStart = queue.top();
+    queue.pop();
     // skip all obsolete events in level
     if (!levelStart->isObsolete()) {
       break;
@@ -1457,12 +1495,12 @@ static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(std::vector<std:
 
   std::shared_ptr<QueueEvent> event = nullptr;
 
-  while (queue.size() > 0) {
-    event = queue[0];
+  while (!queue.empty()) {
+    event = queue.top();
     if (event->distance - levelStartHeight >= EPSILON) {
       break;
     }
-    queue.erase(queue.begin());
+    queue.pop();
     if (!event->isObsolete()) {
       level.push_back(event);
     }
@@ -1694,7 +1732,7 @@ static std::vector<LevelEvent> groupLevelEvents(std::vector<std::shared_ptr<Queu
   return ret;
 }
 
-static std::vector<LevelEvent> loadAndGroupLevelEvents(std::vector<std::shared_ptr<QueueEvent>>& queue,
+static std::vector<LevelEvent> loadAndGroupLevelEvents(EventQueue& queue,
                                                        std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav) {
   std::vector<std::shared_ptr<QueueEvent>> levelEvents = loadLevelEvents(queue);
   return groupLevelEvents(levelEvents, sLav);
@@ -1966,7 +2004,7 @@ static void mergeBeforeBaseVertex(std::shared_ptr<Vertex> base, std::vector<std:
   mergedList.erase(mergedList.begin(), mergedList.end());
 }
 
-static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> vertex, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> vertex, EventQueue& queue,
                                                       std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav) {
   /*
   * Calculate two new edge events for given vertex. Events are generated
@@ -2002,11 +2040,11 @@ static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> ve
 
   if (distance1 - EPSILON < distance2) {
     std::shared_ptr<QueueEvent> e(createEdgeEvent(point1.get(), vertex, nextVertex));
-    QueueEvent::insert_sorted(queue, e);
+    queue.push(e);
   }
   if (distance2 - EPSILON < distance1) {
     std::shared_ptr<QueueEvent> e(createEdgeEvent(point2.get(), previousVertex, vertex));
-    QueueEvent::insert_sorted(queue, e);
+    queue.push(e);
   }
 
   if (distance1 < distance2) {
@@ -2015,7 +2053,7 @@ static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> ve
   return distance2;
 }
 
-static void computeEvents(std::shared_ptr<Vertex> vertex, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void computeEvents(std::shared_ptr<Vertex> vertex, EventQueue& queue,
                           const std::vector<std::shared_ptr<Edge>>& edges, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav) {
   boost::optional<double> distanceSquared = computeCloserEdgeEvent(vertex, queue, sLav);
   computeSplitEvents(vertex, edges, queue, distanceSquared);
@@ -2159,7 +2197,7 @@ static std::vector<std::shared_ptr<Vertex>> cutLavPart(std::vector<std::shared_p
 }
 
 static void multiSplitEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav,
-                            std::vector<std::shared_ptr<QueueEvent>>& queue, const std::vector<std::shared_ptr<Edge>>& edges,
+                            EventQueue& queue, const std::vector<std::shared_ptr<Edge>>& edges,
                             std::vector<std::shared_ptr<Face>>& faces) {
 
   createOppositeEdgeChains(sLav, event.chains, event.point);
@@ -2249,7 +2287,7 @@ static void addFaceBack(std::shared_ptr<Vertex> newVertex, std::shared_ptr<Verte
 }
 
 static void addMultiBackFaces(const std::vector<std::shared_ptr<QueueEvent>>& edgeList, std::shared_ptr<Vertex> edgeVertex,
-                              std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+                              std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                               std::vector<std::shared_ptr<Face>>& faces) {
   for (std::shared_ptr<QueueEvent> edgeEvent : edgeList) {
 
@@ -2263,7 +2301,7 @@ static void addMultiBackFaces(const std::vector<std::shared_ptr<QueueEvent>>& ed
   }
 }
 
-static void pickEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void pickEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                       std::vector<std::shared_ptr<Edge>>& edges, std::vector<std::shared_ptr<Face>>& faces) {
   // lav will be removed so it is final vertex.
   std::shared_ptr<Vertex> pickVertex(new Vertex(event.point, event.distance, nullptr, nullptr, nullptr));
@@ -2273,7 +2311,7 @@ static void pickEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr
 }
 
 static void multiEdgeEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav,
-                           std::vector<std::shared_ptr<QueueEvent>>& queue, const std::vector<std::shared_ptr<Edge>>& edges,
+                           EventQueue& queue, const std::vector<std::shared_ptr<Edge>>& edges,
                            std::vector<std::shared_ptr<Face>>& faces) {
 
   std::shared_ptr<Vertex> prevVertex = event.chain.getPreviousVertex(sLav);
@@ -2307,7 +2345,7 @@ static void multiEdgeEvent(LevelEvent& event, std::vector<std::vector<std::share
   computeEvents(edgeVertex, queue, edges, sLav);
 }
 
-static void processTwoNodeLavs(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void processTwoNodeLavs(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                                std::vector<std::shared_ptr<Face>>& faces) {
   for (std::vector<std::shared_ptr<Vertex>>& lav : sLav) {
     if (lav.size() == 2) {
@@ -2326,12 +2364,12 @@ static void processTwoNodeLavs(std::vector<std::vector<std::shared_ptr<Vertex>>>
   }
 }
 
-static void removeEventsUnderHeight(std::vector<std::shared_ptr<QueueEvent>>& queue, double levelHeight) {
+static void removeEventsUnderHeight(EventQueue& queue, double levelHeight) {
   while (!queue.empty()) {
-    if (queue[0]->distance > levelHeight + EPSILON) {
+    if (queue.top()->distance > levelHeight + EPSILON) {
       break;
     }
-    queue.erase(queue.begin());
+    queue.pop();
   }
 }
 
@@ -2351,7 +2389,7 @@ static void removeEmptyLav(std::vector<std::vector<std::shared_ptr<Vertex>>>& sL
   * Translated from https://github.com/kendzi/kendzi-math
   */
 
-  std::vector<std::shared_ptr<QueueEvent>> queue;
+  EventQueue queue;
   std::vector<std::shared_ptr<Face>> faces;
   std::vector<std::shared_ptr<Edge>> edges;
   std::vector<std::vector<std::shared_ptr<Vertex>>> sLav;
@@ -2367,9 +2405,7 @@ static void removeEmptyLav(std::vector<std::vector<std::shared_ptr<Vertex>>>& sL
     // start processing skeleton level
     count = assertMaxNumberOfIterations(count);
 
-    std::sort(queue.begin(), queue.end(), QueueEvent::Comparer());
-
-    double levelHeight = queue[0]->distance;
+    double levelHeight = queue.top()->distance;
 
     std::vector<LevelEvent> levelEvents = loadAndGroupLevelEvents(queue, sLav);
 
@@ -0,0 +1,259 @@
+#include <benchmark/benchmark.h>
+
+#include "../Geometry.hpp"
+#include "../Intersection.hpp"
+#include "../RoofGeometry.hpp"
+#include "../Point3d.hpp"
+#include "../Vector3d.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace openstudio;
+
+static constexpr double tol = 0.01;
+
+// Convex polygon with n vertices, clockwise on the z = 0 plane (face coordinates reversed) as required by Intersection.hpp
+static std::vector<Point3d> makeClockwisePolygon(size_t n, double radius, double cx = 0.0, double cy = 0.0) {
+  std::vector<Point3d> result;
+  result.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    double angle = -2.0 * boost::math::constants::pi<double>() * static_cast<double>(i) / static_cast<double>(n);
+    result.emplace_back(cx + radius * std::cos(angle), cy + radius * std::sin(angle), 0.0);
+  }
+  return result;
+}
+
+// Concave star shaped polygon with n vertices, clockwise on the z = 0 plane
+static std::vector<Point3d> makeClockwiseStar(size_t n, double radius) {
+  std::vector<Point3d> result;
+  result.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    double angle = -2.0 * boost::math::constants::pi<double>() * static_cast<double>(i) / static_cast<double>(n);
+    double r = (i % 2 == 0) ? radius : 0.7 * radius;
+    result.emplace_back(r * std::cos(angle), r * std::sin(angle), 0.0);
+  }
+  return result;
+}
+
+// Rectangle with n vertices, the extra vertices are collinear points along the edges
+static std::vector<Point3d> makeRectangleWithCollinearPoints(size_t n, double width, double height) {
+  std::vector<Point3d> corners{Point3d(0, height, 0), Point3d(width, height, 0), Point3d(width, 0, 0), Point3d(0, 0, 0)};
+  size_t perEdge = std::max<size_t>(1, n / 4);
+  std::vector<Point3d> result;
+  result.reserve(4 * perEdge);
+  for (size_t c = 0; c < 4; ++c) {
+    const Point3d& p1 = corners[c];
+    const Point3d& p2 = corners[(c + 1) % 4];
+    for (size_t i = 0; i < perEdge; ++i) {
+      double t = static_cast<double>(i) / static_cast<double>(perEdge);
+      result.emplace_back(p1.x() + t * (p2.x() - p1.x()), p1.y() + t * (p2.y() - p1.y()), 0.0);
+    }
+  }
+  return result;
+}
+
+// n adjacent unit squares in a row, clockwise, as produced when combining floor prints of adjacent spaces
+static std::vector<std::vector<Point3d>> makeRowOfSquares(size_t n) {
+  std::vector<std::vector<Point3d>> result;
+  result.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    double x = static_cast<double>(i);
+    result.push_back({Point3d(x, 1, 0), Point3d(x + 1, 1, 0), Point3d(x + 1, 0, 0), Point3d(x, 0, 0)});
+  }
+  return result;
+}
+
+// Counterclockwise footprint for the roof generators, a comb with n vertices
+static std::vector<Point3d> makeRoofFootprint(size_t n) {
+  size_t teeth = std::max<size_t>(1, (n - 2) / 4);
+  std::vector<Point3d> result;
+  result.emplace_back(0, 0, 0);
+  result.emplace_back(4.0 * teeth, 0, 0);
+  for (size_t i = teeth; i > 0; --i) {
+    double x = 4.0 * i;
+    result.emplace_back(x, 10, 0);
+    result.emplace_back(x - 2, 10, 0);
+    result.emplace_back(x - 2, 6, 0);
+    result.emplace_back(x - 4, 6, 0);
+  }
+  return result;
+}
+
+static void BM_Intersect(benchmark::State& state) {
+  std::vector<Point3d> polygon1 = makeClockwisePolygon(state.range(0), 10.0);
+  std::vector<Point3d> polygon2 = makeClockwisePolygon(state.range(0), 10.0, 5.0, 5.0);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(intersect(polygon1, polygon2, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_Subtract(benchmark::State& state) {
+  std::vector<Point3d> polygon = makeClockwiseStar(state.range(0), 10.0);
+  std::vector<std::vector<Point3d>> holes{makeClockwisePolygon(state.range(0), 3.0, 2.0, 0.0)};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(subtract(polygon, holes, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_Join(benchmark::State& state) {
+  std::vector<Point3d> polygon1 = makeClockwisePolygon(state.range(0), 10.0);
+  std::vector<Point3d> polygon2 = makeClockwisePolygon(state.range(0), 10.0, 5.0, 5.0);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(join(polygon1, polygon2, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_JoinAll(benchmark::State& state) {
+  std::vector<std::vector<Point3d>> polygons = makeRowOfSquares(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(joinAll(polygons, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_Buffer(benchmark::State& state) {
+  std::vector<Point3d> polygon = makeClockwiseStar(state.range(0), 10.0);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buffer(polygon, 0.1, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_RemoveSpikes(benchmark::State& state) {
+  std::vector<Point3d> polygon = makeClockwiseStar(state.range(0), 10.0);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(removeSpikes(polygon, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_ComputeTriangulation(benchmark::State& state) {
+  std::vector<Point3d> polygon = makeClockwiseStar(state.range(0), 10.0);
+  std::vector<std::vector<Point3d>> holes;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(computeTriangulation(polygon, holes, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_RemoveCollinear(benchmark::State& state) {
+  std::vector<Point3d> polygon = makeRectangleWithCollinearPoints(state.range(0), 20.0, 10.0);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(removeCollinear(polygon, tol));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GetCentroid(benchmark::State& state) {
+  std::vector<Point3d> polygon = makeClockwiseStar(state.range(0), 10.0);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getCentroid(polygon));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GenerateHipRoof(benchmark::State& state) {
+  std::vector<Point3d> footprint = makeRoofFootprint(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<Point3d> copy(footprint);
+    benchmark::DoNotOptimize(generateHipRoof(copy, 30.0));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GenerateGableRoof(benchmark::State& state) {
+  std::vector<Point3d> footprint = makeRoofFootprint(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<Point3d> copy(footprint);
+    benchmark::DoNotOptimize(generateGableRoof(copy, 30.0));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Footprints from RoofGeometry_GTest.cpp that exercise pick, multi edge, multi split and double split events
+static std::vector<std::vector<Point3d>> makeRoofTestFootprints() {
+  std::vector<std::vector<Point3d>> result;
+  result.push_back({Point3d(-1, -1, 0), Point3d(1, -1, 0), Point3d(1, 1, 0), Point3d(-1, 1, 0)});
+  result.push_back({Point3d(0, 1, 0), Point3d(-1, 0, 0), Point3d(0, -1, 0), Point3d(5, -2, 0), Point3d(7, 0, 0), Point3d(5, 2, 0)});
+  result.push_back({Point3d(-3.0, -1.0, 0.0), Point3d(3.0, -1.0, 0.0), Point3d(3.0, 1.0, 0.0), Point3d(1.0, 1.0, 0.0), Point3d(1.0, 3.0, 0.0),
+                    Point3d(-1.0, 3.0, 0.0), Point3d(-1.0, 1.0, 0.0), Point3d(-3.0, 1.0, 0.0)});
+  result.push_back({Point3d(-3.0, -1.0, 0.0), Point3d(-1.0, -1.0, 0.0), Point3d(-1.0, -3.0, 0.0), Point3d(1.0, -3.0, 0.0), Point3d(1.0, -1.0, 0.0),
+                    Point3d(3.0, -1.0, 0.0), Point3d(3.0, 1.0, 0.0), Point3d(1.0, 1.0, 0.0), Point3d(1.0, 3.0, 0.0), Point3d(-1.0, 3.0, 0.0),
+                    Point3d(-1.0, 1.0, 0.0), Point3d(-3.0, 1.0, 0.0)});
+  result.push_back({Point3d(-6.0, 0.0, 0.0), Point3d(-3.0, -6.0, 0.0), Point3d(-1.0, -2.0, 0.0), Point3d(1.0, -2.0, 0.0), Point3d(3.0, -6.0, 0.0),
+                    Point3d(6.0, 0.0, 0.0)});
+  result.push_back({Point3d(-6.0, 0.0, 0.0), Point3d(-3.0, -6.0, 0.0), Point3d(-1.0, -2.0, 0.0), Point3d(0.0, -3.0, 0.0), Point3d(1.0, -2.0, 0.0),
+                    Point3d(3.0, -6.0, 0.0), Point3d(6.0, 0.0, 0.0)});
+  return result;
+}
+
+static void BM_GenerateHipRoofTestFootprints(benchmark::State& state) {
+  const std::vector<std::vector<Point3d>> footprints = makeRoofTestFootprints();
+
+  for (auto _ : state) {
+    for (const auto& footprint : footprints) {
+      // generators modify the footprint in place
+      std::vector<Point3d> copy(footprint);
+      benchmark::DoNotOptimize(generateHipRoof(copy, 30.0));
+    }
+  }
+}
+
+static void BM_GenerateGableRoofTestFootprints(benchmark::State& state) {
+  const std::vector<std::vector<Point3d>> footprints = makeRoofTestFootprints();
+
+  for (auto _ : state) {
+    for (const auto& footprint : footprints) {
+      std::vector<Point3d> copy(footprint);
+      benchmark::DoNotOptimize(generateGableRoof(copy, 30.0));
+    }
+  }
+}
+
+// Polygon sizes from a rectangle up to a finely discretized curved wall
+BENCHMARK(BM_Intersect)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+BENCHMARK(BM_Subtract)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+BENCHMARK(BM_Join)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+BENCHMARK(BM_Buffer)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+BENCHMARK(BM_RemoveSpikes)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+BENCHMARK(BM_ComputeTriangulation)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+BENCHMARK(BM_RemoveCollinear)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+BENCHMARK(BM_GetCentroid)->RangeMultiplier(2)->Range(4, 512)->Complexity();
+
+// Number of polygons rather than vertices
+BENCHMARK(BM_JoinAll)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(4, 128)->Complexity();
+
+// Roof footprints get expensive quickly, sweep a smaller range
+BENCHMARK(BM_GenerateHipRoof)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(6, 194)->Complexity();
+BENCHMARK(BM_GenerateGableRoof)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(6, 194)->Complexity();
+BENCHMARK(BM_GenerateHipRoofTestFootprints);
+BENCHMARK(BM_GenerateGableRoofTestFootprints);
@@ -35,6 +35,7 @@
 #include "../Point3d.hpp"
 #include "../Polygon3d.hpp"
 #include "../PointLatLon.hpp"
+#include "../PointWelder.hpp"
 #include "../Vector3d.hpp"
 
 using namespace std;
@@ -1194,3 +1195,33 @@ TEST_F(GeometryFixture, Polygon3d_WithHole) {
   EXPECT_NE(grossArea, netArea);
   EXPECT_EQ(netArea, 8400);
 }
+
+TEST_F(GeometryFixture, PointWelder) {
+  double tol = 0.01;
+
+  PointWelder welder(tol);
+  std::vector<Point3d> allPoints;
+
+  // points spread over cell boundaries, with near duplicates
+  std::vector<Point3d> points;
+  for (unsigned i = 0; i < 50; ++i) {
+    double x = 0.0049 * i;
+    points.push_back(Point3d(x, 1.0, 0.0));
+    points.push_back(Point3d(x + 0.009, 1.0 - 0.001, 0.0));
+    points.push_back(Point3d(-x, -1.0, 0.005));
+  }
+
+  for (const Point3d& point : points) {
+    Point3d expected = getCombinedPoint(point, allPoints, tol);
+    Point3d welded = welder.weld(point);
+    EXPECT_EQ(expected, welded) << point;
+  }
+
+  ASSERT_EQ(allPoints.size(), welder.points().size());
+  for (unsigned i = 0; i < allPoints.size(); ++i) {
+    EXPECT_EQ(allPoints[i], welder.points()[i]);
+  }
+
+  EXPECT_EQ(0u, welder.weldIndex(points[0]));
+  EXPECT_EQ(allPoints.size(), welder.weldIndex(Point3d(100, 100, 100)));
+}
@@ -851,6 +851,29 @@ TEST_F(GeometryFixture, JoinAll) {
   EXPECT_EQ(4.0, totalArea(test));
 }
 
+TEST_F(GeometryFixture, JoinAll_Grid) {
+  double tol = 0.01;
+
+  // two separate 10 x 10 blocks of unit squares
+  std::vector<Point3dVector> polygons;
+  for (unsigned i = 0; i < 10; ++i) {
+    for (unsigned j = 0; j < 10; ++j) {
+      polygons.push_back(makeRectangleDown(i, j, 1, 1));
+      polygons.push_back(makeRectangleDown(20 + i, j, 1, 1));
+    }
+  }
+
+  std::vector<Point3dVector> test = joinAll(polygons, tol);
+  ASSERT_EQ(2u, test.size());
+  EXPECT_TRUE(circularEqual(makeRectangleDown(0, 0, 10, 10), test[0])) << test[0];
+  EXPECT_TRUE(circularEqual(makeRectangleDown(20, 0, 10, 10), test[1])) << test[1];
+
+  std::vector<Polygon3d> testPolygons = joinAllPolygons(polygons, tol);
+  ASSERT_EQ(2u, testPolygons.size());
+  EXPECT_NEAR(100.0, testPolygons[0].grossArea(), tol);
+  EXPECT_NEAR(100.0, testPolygons[1].grossArea(), tol);
+}
+
 TEST_F(GeometryFixture, RemoveSpikes_Down) {
   double tol = 0.01;
 
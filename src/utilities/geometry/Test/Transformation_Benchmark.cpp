@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include "../Transformation.hpp"
+#include "../Point3d.hpp"
+#include "../Vector3d.hpp"
+#include "../../data/Matrix.hpp"
+#include "../../data/Vector.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+
+// Reference implementation of the previous Transformation, which stored a heap allocated ublas matrix
+// and multiplied every point through a temporary ublas vector
+static Point3d ublasTransform(const Matrix& storage, const Point3d& point) {
+  Vector temp(4);
+  temp(0) = point.x();
+  temp(1) = point.y();
+  temp(2) = point.z();
+  temp(3) = 1.0;
+  temp = prod(storage, temp);
+  return Point3d(temp[0], temp[1], temp[2]);
+}
+
+static std::vector<Point3d> makePoints(size_t n) {
+  std::vector<Point3d> points;
+  points.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    points.emplace_back(static_cast<double>(i % 1000), static_cast<double>((i / 1000) % 1000), static_cast<double>(i % 7));
+  }
+  return points;
+}
+
+static Transformation makeTransformation() {
+  return Transformation::translation(Vector3d(10.0, -5.0, 3.0)) * Transformation::rotation(Vector3d(1.0, 1.0, 1.0), 0.3);
+}
+
+static void BM_TransformPointsUblas(benchmark::State& state) {
+  std::vector<Point3d> points = makePoints(state.range(0));
+  Matrix storage = makeTransformation().matrix();
+
+  for (auto _ : state) {
+    std::vector<Point3d> result(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      result[i] = ublasTransform(storage, points[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TransformPointsOneByOne(benchmark::State& state) {
+  std::vector<Point3d> points = makePoints(state.range(0));
+  Transformation t = makeTransformation();
+
+  for (auto _ : state) {
+    std::vector<Point3d> result(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      result[i] = t * points[i];
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TransformPointsBatch(benchmark::State& state) {
+  std::vector<Point3d> points = makePoints(state.range(0));
+  Transformation t = makeTransformation();
+
+  for (auto _ : state) {
+    std::vector<Point3d> result = t * points;
+    benchmark::DoNotOptimize(result.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TransformationProductUblas(benchmark::State& state) {
+  Matrix a = makeTransformation().matrix();
+  Matrix b = makeTransformation().inverse().matrix();
+
+  for (auto _ : state) {
+    Matrix c = prod(a, b);
+    benchmark::DoNotOptimize(c.data().begin());
+  }
+}
+
+static void BM_TransformationProduct(benchmark::State& state) {
+  Transformation a = makeTransformation();
+  Transformation b = makeTransformation().inverse();
+
+  for (auto _ : state) {
+    Transformation c = a * b;
+    benchmark::DoNotOptimize(&c);
+  }
+}
+
+// Million vertex model
+BENCHMARK(BM_TransformPointsUblas)->Unit(benchmark::kMillisecond)->Arg(1000000);
+BENCHMARK(BM_TransformPointsOneByOne)->Unit(benchmark::kMillisecond)->Arg(1000000);
+BENCHMARK(BM_TransformPointsBatch)->Unit(benchmark::kMillisecond)->Arg(1000000);
+
+// Typical surface
+BENCHMARK(BM_TransformPointsUblas)->Arg(4);
+BENCHMARK(BM_TransformPointsOneByOne)->Arg(4);
+BENCHMARK(BM_TransformPointsBatch)->Arg(4);
+
+// Surface with many vertices, one full block and a partial one
+BENCHMARK(BM_TransformPointsOneByOne)->Arg(100);
+BENCHMARK(BM_TransformPointsBatch)->Arg(100);
+
+BENCHMARK(BM_TransformationProductUblas);
+BENCHMARK(BM_TransformationProduct);
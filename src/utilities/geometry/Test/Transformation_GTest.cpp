@@ -582,3 +582,24 @@ TEST_F(GeometryFixture, Transformation_Decompose) {
 
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << '\n' << test.matrix();
 }
+
+TEST_F(GeometryFixture, Transformation_VectorStorage) {
+  Transformation transformation = Transformation::translation(Vector3d(1, 2, 3)) * Transformation::rotation(Vector3d(1, 1, 0), degToRad(30));
+
+  Transformation test(transformation.vector());
+  EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << '\n' << test.matrix();
+
+  std::vector<Point3d> points;
+  for (unsigned i = 0; i < 100; ++i) {
+    points.push_back(Point3d(i, 2.0 * i, -0.5 * i));
+  }
+
+  std::vector<Point3d> result = transformation * points;
+  ASSERT_EQ(points.size(), result.size());
+  for (unsigned i = 0; i < points.size(); ++i) {
+    Point3d expected = transformation * points[i];
+    EXPECT_DOUBLE_EQ(expected.x(), result[i].x());
+    EXPECT_DOUBLE_EQ(expected.y(), result[i].y());
+    EXPECT_DOUBLE_EQ(expected.z(), result[i].z());
+  }
+}
@@ -48,42 +48,38 @@ using std::min;
 namespace openstudio {
 
 /// default constructor creates identity transformation
-Transformation::Transformation() : m_storage(identity_matrix<double>(4)) {}
+Transformation::Transformation() : m_storage{1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0} {}
 
 /// copy constructor
 Transformation::Transformation(const Transformation& other) : m_storage(other.m_storage) {}
 
 /// constructor from storage, asserts matrix is 4x4
-Transformation::Transformation(const Matrix& matrix) : m_storage(matrix) {
+Transformation::Transformation(const Matrix& matrix) {
   OS_ASSERT(matrix.size1() == 4);
   OS_ASSERT(matrix.size2() == 4);
+
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      at(i, j) = matrix(i, j);
+    }
+  }
 }
 
 /// constructor from storage, asserts vector is size 16
-Transformation::Transformation(const Vector& vector) : m_storage(Matrix(4, 4)) {
+Transformation::Transformation(const Vector& vector) {
   OS_ASSERT(vector.size() == 16);
 
-  m_storage(0, 0) = vector[0];
-  m_storage(1, 0) = vector[1];
-  m_storage(2, 0) = vector[2];
-  m_storage(3, 0) = vector[3];
-  m_storage(0, 1) = vector[4];
-  m_storage(1, 1) = vector[5];
-  m_storage(2, 1) = vector[6];
-  m_storage(2, 1) = vector[7];
-  m_storage(0, 2) = vector[8];
-  m_storage(1, 2) = vector[9];
-  m_storage(2, 2) = vector[10];
-  m_storage(3, 2) = vector[11];
-  m_storage(0, 3) = vector[12];
-  m_storage(1, 3) = vector[13];
-  m_storage(2, 3) = vector[14];
-  m_storage(3, 3) = vector[15];
+  // column major, same as vector()
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      at(i, j) = vector[4 * j + i];
+    }
+  }
 }
 
 /// rotation about origin defined by axis and angle (radians)
 Transformation Transformation::rotation(const Vector3d& axis, double radians) {
-  Matrix storage = identity_matrix<double>(4);
+  Transformation result;
 
   Vector3d temp = axis;
   if (!temp.normalize()) {
@@ -109,11 +105,11 @@ Transformation Transformation::rotation(const Vector3d& axis, double radians) {
 
   for (unsigned i = 0; i < 3; ++i) {
     for (unsigned j = 0; j < 3; ++j) {
-      storage(i, j) = R(i, j);
+      result.at(i, j) = R(i, j);
     }
   }
 
-  return Transformation(storage);
+  return result;
 }
 
 /// rotation about point defined by axis and angle (radians)
@@ -133,13 +129,13 @@ Transformation Transformation::rotation(const EulerAngles& angles) {
 
 /// translation along vector
 Transformation Transformation::translation(const Vector3d& translation) {
-  Matrix storage = identity_matrix<double>(4);
+  Transformation result;
 
-  storage(0, 3) = translation.x();
-  storage(1, 3) = translation.y();
-  storage(2, 3) = translation.z();
+  result.at(0, 3) = translation.x();
+  result.at(1, 3) = translation.y();
+  result.at(2, 3) = translation.z();
 
-  return Transformation(storage);
+  return result;
 }
 
 /// transforms system with z' to regular system
@@ -174,18 +170,18 @@ Transformation Transformation::alignZPrime(const Vector3d& zPrime) {
     yp = zp.cross(xp);
   }
 
-  Matrix storage = identity_matrix<double>(4);
-  storage(0, 0) = xp.x();
-  storage(1, 0) = xp.y();
-  storage(2, 0) = xp.z();
-  storage(0, 1) = yp.x();
-  storage(1, 1) = yp.y();
-  storage(2, 1) = yp.z();
-  storage(0, 2) = zp.x();
-  storage(1, 2) = zp.y();
-  storage(2, 2) = zp.z();
-
-  return Transformation(storage);
+  Transformation result;
+  result.at(0, 0) = xp.x();
+  result.at(1, 0) = xp.y();
+  result.at(2, 0) = xp.z();
+  result.at(0, 1) = yp.x();
+  result.at(1, 1) = yp.y();
+  result.at(2, 1) = yp.z();
+  result.at(0, 2) = zp.x();
+  result.at(1, 2) = zp.y();
+  result.at(2, 2) = zp.z();
+
+  return result;
 }
 
 /// transforms face coordinates to regular system, face normal will be z'
@@ -221,7 +217,7 @@ Transformation Transformation::alignFace(const std::vector<Point3d>& vertices) {
 /// returns a transformation which is the inverse of this
 Transformation Transformation::inverse() const {
   Matrix matrix(4, 4);
-  bool test = invert(m_storage, matrix);
+  bool test = invert(this->matrix(), matrix);
   if (!test) {
     // this should never happen
     LOG_AND_THROW("Matrix inversion failed");
@@ -231,28 +227,23 @@ Transformation Transformation::inverse() const {
 
 /// get the matrix representation directly
 Matrix Transformation::matrix() const {
-  return m_storage;
+  Matrix result(4, 4);
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      result(i, j) = at(i, j);
+    }
+  }
+  return result;
 }
 
 /// get the vector representation directly
 Vector Transformation::vector() const {
   openstudio::Vector result(16);
-  result[0] = m_storage(0, 0);
-  result[1] = m_storage(1, 0);
-  result[2] = m_storage(2, 0);
-  result[3] = m_storage(3, 0);
-  result[4] = m_storage(0, 1);
-  result[5] = m_storage(1, 1);
-  result[6] = m_storage(2, 1);
-  result[7] = m_storage(3, 1);
-  result[8] = m_storage(0, 2);
-  result[9] = m_storage(1, 2);
-  result[10] = m_storage(2, 2);
-  result[11] = m_storage(3, 2);
-  result[12] = m_storage(0, 3);
-  result[13] = m_storage(1, 3);
-  result[14] = m_storage(2, 3);
-  result[15] = m_storage(3, 3);
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      result[4 * j + i] = at(i, j);
+    }
+  }
   return result;
 }
 
@@ -261,19 +252,19 @@ EulerAngles Transformation::eulerAngles() const {
   double psi;
   double theta;
   double phi;
-  if (m_storage(2, 0) == 1.0) {
+  if (at(2, 0) == 1.0) {
     phi = 0;
     theta = -boost::math::constants::pi<double>() / 2.0;
-    psi = atan2(-m_storage(0, 1), -m_storage(0, 2));
-  } else if (m_storage(2, 0) == -1.0) {
+    psi = atan2(-at(0, 1), -at(0, 2));
+  } else if (at(2, 0) == -1.0) {
     phi = 0;
     theta = boost::math::constants::pi<double>() / 2.0;
-    psi = atan2(m_storage(0, 1), m_storage(0, 2));
+    psi = atan2(at(0, 1), at(0, 2));
   } else {
-    theta = -asin(m_storage(2, 0));
+    theta = -asin(at(2, 0));
     // theta = pi + asin(m_storage(2,0)); // alternate solution
-    psi = atan2(m_storage(2, 1) / cos(theta), m_storage(2, 2) / cos(theta));
-    phi = atan2(m_storage(1, 0) / cos(theta), m_storage(0, 0) / cos(theta));
+    psi = atan2(at(2, 1) / cos(theta), at(2, 2) / cos(theta));
+    phi = atan2(at(1, 0) / cos(theta), at(0, 0) / cos(theta));
   }
   EulerAngles result(psi, theta, phi);
   return result;
@@ -284,7 +275,7 @@ Matrix Transformation::rotationMatrix() const {
   Matrix result(3, 3);
   for (unsigned i = 0; i < 3; ++i) {
     for (unsigned j = 0; j < 3; ++j) {
-      result(i, j) = m_storage(i, j);
+      result(i, j) = at(i, j);
     }
   }
   return result;
@@ -292,30 +283,27 @@ Matrix Transformation::rotationMatrix() const {
 
 /// get the translation for the transformation, does not include rotation
 Vector3d Transformation::translation() const {
-  Vector3d result(m_storage(0, 3), m_storage(1, 3), m_storage(2, 3));
+  Vector3d result(at(0, 3), at(1, 3), at(2, 3));
   return result;
 }
 
 /// apply the transformation to the point
 Point3d Transformation::operator*(const Point3d& point) const {
-  Vector temp(4);
-  temp(0) = point.x();
-  temp(1) = point.y();
-  temp(2) = point.z();
-  temp(3) = 1.0;
-  temp = prod(m_storage, temp);
-  return Point3d(temp[0], temp[1], temp[2]);
+  const double x = point.x();
+  const double y = point.y();
+  const double z = point.z();
+  return Point3d(at(0, 0) * x + at(0, 1) * y + at(0, 2) * z + at(0, 3), at(1, 0) * x + at(1, 1) * y + at(1, 2) * z + at(1, 3),
+                 at(2, 0) * x + at(2, 1) * y + at(2, 2) * z + at(2, 3));
 }
 
 /// apply the transformation to the vector
 Vector3d Transformation::operator*(const Vector3d& vector) const {
-  Vector temp(4);
-  temp(0) = vector.x();
-  temp(1) = vector.y();
-  temp(2) = vector.z();
-  temp(3) = 1.0;
-  temp = prod(m_storage, temp);
-  return Vector3d(temp[0], temp[1], temp[2]);
+  // vectors are transformed as points, including the translation
+  const double x = vector.x();
+  const double y = vector.y();
+  const double z = vector.z();
+  return Vector3d(at(0, 0) * x + at(0, 1) * y + at(0, 2) * z + at(0, 3), at(1, 0) * x + at(1, 1) * y + at(1, 2) * z + at(1, 3),
+                  at(2, 0) * x + at(2, 1) * y + at(2, 2) * z + at(2, 3));
 }
 
 /// apply the transformation to the BoundingBox
@@ -345,9 +333,34 @@ Plane Transformation::operator*(const Plane& plane) const {
 
 /// apply the transformation to a vector of points
 std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const {
-  std::vector<Point3d> result(points.size());
-  for (unsigned i = 0; i < points.size(); ++i) {
-    result[i] = (*this) * points[i];
+  const double m00 = at(0, 0), m01 = at(0, 1), m02 = at(0, 2), m03 = at(0, 3);
+  const double m10 = at(1, 0), m11 = at(1, 1), m12 = at(1, 2), m13 = at(1, 3);
+  const double m20 = at(2, 0), m21 = at(2, 1), m22 = at(2, 2), m23 = at(2, 3);
+
+  // coordinates are gathered into small contiguous blocks on the stack, the multiply loop over a block
+  // has no dependencies between points so the compiler can vectorize it
+  constexpr std::size_t blockSize = 64;
+  double x[blockSize], y[blockSize], z[blockSize];
+  double outX[blockSize], outY[blockSize], outZ[blockSize];
+
+  std::vector<Point3d> result;
+  result.reserve(points.size());
+  for (std::size_t begin = 0; begin < points.size(); begin += blockSize) {
+    const std::size_t n = std::min(blockSize, points.size() - begin);
+    for (std::size_t i = 0; i < n; ++i) {
+      const Point3d& point = points[begin + i];
+      x[i] = point.x();
+      y[i] = point.y();
+      z[i] = point.z();
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      outX[i] = m00 * x[i] + m01 * y[i] + m02 * z[i] + m03;
+      outY[i] = m10 * x[i] + m11 * y[i] + m12 * z[i] + m13;
+      outZ[i] = m20 * x[i] + m21 * y[i] + m22 * z[i] + m23;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      result.emplace_back(outX[i], outY[i], outZ[i]);
+    }
   }
   return result;
 }
@@ -363,7 +376,13 @@ std::vector<Vector3d> Transformation::operator*(const std::vector<Vector3d>& vec
 
 /// apply the transformation to the other transformation
 Transformation Transformation::operator*(const Transformation& other) const {
-  return Transformation(prod(m_storage, other.m_storage));
+  Transformation result;
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      result.at(i, j) = at(i, 0) * other.at(0, j) + at(i, 1) * other.at(1, j) + at(i, 2) * other.at(2, j) + at(i, 3) * other.at(3, j);
+    }
+  }
+  return result;
 }
 
 /// ostream operator
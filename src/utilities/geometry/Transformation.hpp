@@ -35,6 +35,7 @@
 #include "../data/Vector.hpp"
 #include "../core/Logger.hpp"
 
+#include <array>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -114,7 +115,7 @@ class UTILITIES_API Transformation
   /// apply the transformation to the plane
   Plane operator*(const Plane& plane) const;
 
-  /// apply the transformation to a vector of points
+  /// apply the transformation to a vector of points, coordinates are transformed in blocks that the compiler can vectorize
   std::vector<Point3d> operator*(const std::vector<Point3d>& points) const;
 
   /// apply the transformation to a vector of vector
@@ -125,7 +126,16 @@ class UTILITIES_API Transformation
 
  private:
   REGISTER_LOGGER("utilities.Transformation");
-  Matrix m_storage;
+  // row major 4x4 matrix, fixed size so that transformations do not allocate
+  std::array<double, 16> m_storage;
+
+  double& at(unsigned i, unsigned j) {
+    return m_storage[4 * i + j];
+  }
+
+  double at(unsigned i, unsigned j) const {
+    return m_storage[4 * i + j];
+  }
 };
 
 /// ostream operator
@@ -1816,6 +1816,40 @@ TEST_F(IdfFixture, Workspace_AddObjects) {
   }
 }
 
+TEST_F(IdfFixture, Workspace_AddObjects_ManyNamedPointers) {
+  // enough objects that addObjects resolves names through an index
+  std::vector<IdfObject> idfObjects;
+  for (int i = 0; i < 200; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i));
+    idfObjects.push_back(zone);
+
+    IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+    surface.setName("Surface " + std::to_string(i));
+    // names resolve without regard to case
+    surface.setString(BuildingSurface_DetailedFields::ZoneName, "ZONE " + std::to_string(i));
+    surface.setString(BuildingSurface_DetailedFields::ConstructionName, "Missing Construction");
+    idfObjects.push_back(surface);
+  }
+
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  std::vector<WorkspaceObject> added = workspace.addObjects(idfObjects);
+  ASSERT_EQ(400u, added.size());
+
+  for (int i = 0; i < 200; ++i) {
+    WorkspaceObject surface = added[2 * i + 1];
+    boost::optional<WorkspaceObject> zone = surface.getTarget(BuildingSurface_DetailedFields::ZoneName);
+    ASSERT_TRUE(zone);
+    EXPECT_EQ(added[2 * i].handle(), zone->handle());
+    EXPECT_FALSE(surface.getTarget(BuildingSurface_DetailedFields::ConstructionName));
+  }
+
+  // the index only lives during addObjects, later lookups see renamed objects
+  EXPECT_TRUE(added[0].setName("Renamed Zone"));
+  EXPECT_TRUE(workspace.getObjectByNameAndReference("renamed zone", added[0].iddObject().references()));
+  EXPECT_FALSE(workspace.getObjectByNameAndReference("Zone 0", added[0].iddObject().references()));
+}
+
 TEST_F(IdfFixture, Workspace_AddObjects2) {
   // Test added to demonstrate false warning message.
 
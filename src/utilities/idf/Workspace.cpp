@@ -41,8 +41,12 @@
 #include "../core/Assert.hpp"
 #include "../core/StringHelpers.hpp"
 
+#include <boost/algorithm/string/case_conv.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
+#include <functional>
+
 using namespace std;
 using openstudio::istringEqual;  // used for all name comparisons
 
@@ -380,6 +384,15 @@ namespace detail {
     return result;
   }
 
+  std::vector<IddObjectType> Workspace_Impl::iddObjectTypes() const {
+    std::vector<IddObjectType> result;
+    result.reserve(m_iddObjectTypeMap.size());
+    for (const IddObjectTypeMap::value_type& p : m_iddObjectTypeMap) {
+      result.push_back(p.first);
+    }
+    return result;
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
     for (const WorkspaceObject& object : getObjectsByType(objectType)) {
       OptionalString candidate = object.name();
@@ -434,6 +447,17 @@ namespace detail {
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByNameAndReference(std::string name,
                                                                                const std::vector<std::string>& referenceNames) const {
+    if (m_nameAndReferenceIndex) {
+      const std::string upperName = boost::to_upper_copy(name);
+      for (const std::string& referenceName : referenceNames) {
+        auto it = m_nameAndReferenceIndex->find(std::make_pair(referenceName, upperName));
+        if (it != m_nameAndReferenceIndex->end()) {
+          return WorkspaceObject(it->second);
+        }
+      }
+      return boost::none;
+    }
+
     for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
       OptionalString candidate = object.name();
       if (candidate && istringEqual(*candidate, name)) {
@@ -500,10 +524,20 @@ namespace detail {
 
     // step 2: replace string pointers
     if (ok) {
-      for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
-        ptr->initializeOnAdd(expectToLosePointers);
-        this->progressValue.nano_emit(++i);
+      // index names once for large additions, such as loading an IdfFile
+      if (objectImplPtrs.size() > 100u) {
+        buildNameAndReferenceIndex();
+      }
+      try {
+        for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+          ptr->initializeOnAdd(expectToLosePointers);
+          this->progressValue.nano_emit(++i);
+        }
+      } catch (...) {
+        m_nameAndReferenceIndex.reset();
+        throw;
       }
+      m_nameAndReferenceIndex.reset();
     }
 
     // step 3: handle provided relationships
@@ -562,9 +596,20 @@ namespace detail {
                                                          const HandleMap& oldNewHandleMap, bool collectionClone,
                                                          const std::vector<UHPointer>& pointersIntoWorkspace,
                                                          const std::vector<HUPointer>& pointersFromWorkspace, bool driverMethod) {
+    std::vector<const HandleMap*> objectHandleMaps(objectImplPtrs.size(), &oldNewHandleMap);
+    return addClones(objectImplPtrs, objectHandleMaps, collectionClone, pointersIntoWorkspace, pointersFromWorkspace, driverMethod);
+  }
+
+  std::vector<WorkspaceObject> Workspace_Impl::addClones(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs,
+                                                         const std::vector<const HandleMap*>& objectHandleMaps, bool collectionClone,
+                                                         const std::vector<UHPointer>& pointersIntoWorkspace,
+                                                         const std::vector<HUPointer>& pointersFromWorkspace, bool driverMethod) {
+    OS_ASSERT(objectHandleMaps.size() == objectImplPtrs.size());
+    bool mapped = std::any_of(objectHandleMaps.begin(), objectHandleMaps.end(), [](const HandleMap* m) { return !m->empty(); });
+
     int i = 0;
     int N = objectImplPtrs.size();
-    if (oldNewHandleMap.empty()) {
+    if (!mapped) {
       this->progressRange.nano_emit(0, 2 * N);
     } else {
       this->progressRange.nano_emit(0, 3 * N);
@@ -583,19 +628,20 @@ namespace detail {
     }
 
     // step 2: apply handle map to pointers
-    if (!oldNewHandleMap.empty()) {
-      for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
-        ptr->initializeOnClone(oldNewHandleMap);
+    if (mapped) {
+      for (int j = 0; j < N; ++j) {
+        objectImplPtrs[j]->initializeOnClone(*objectHandleMaps[j]);
         this->progressValue.nano_emit(++i);
       }
     }
 
     // step 3: apply handle map to orderer
-    if (!oldNewHandleMap.empty() && m_workspaceObjectOrder.isDirectOrder()) {
+    if (mapped && m_workspaceObjectOrder.isDirectOrder()) {
       if (collectionClone) {
         // objects in order, just under wrong handles
+        OS_ASSERT(std::adjacent_find(objectHandleMaps.begin(), objectHandleMaps.end(), std::not_equal_to<const HandleMap*>()) == objectHandleMaps.end());
         HandleVector directOrderVector = order().directOrder().get();
-        HandleVector mappedOrder = applyHandleMap(directOrderVector, oldNewHandleMap);
+        HandleVector mappedOrder = applyHandleMap(directOrderVector, *objectHandleMaps.front());
         m_workspaceObjectOrder.setDirectOrder(mappedOrder);
       } else {
         // new objects not yet in order
@@ -973,6 +1019,83 @@ namespace detail {
     return result;
   }
 
+  std::vector<WorkspaceObject> Workspace_Impl::addCopies(const std::vector<WorkspaceObject>& objects, unsigned nCopies) {
+    WorkspaceObjectVector result;
+    if (objects.empty() || (nCopies == 0)) {
+      return result;
+    }
+
+    Workspace thisWorkspace = workspace();
+    std::set<Handle> originals;
+    for (const WorkspaceObject& object : objects) {
+      if (object.workspace() != thisWorkspace) {
+        LOG(Error, "Unable to add copies of " << object.briefDescription() << ", which is not in this Workspace.");
+        return result;
+      }
+      if (!originals.insert(object.handle()).second) {
+        LOG(Error, "Unable to add copies of " << object.briefDescription() << ", which is listed more than once.");
+        return result;
+      }
+    }
+
+    // Every copied name conflicts with its original. Rather than resolving each conflict with
+    // nextName, which scans the whole Workspace, collect the largest suffix in use for each base
+    // name in one pass and hand out the following ones.
+    std::map<std::string, int> nextSuffixes;  // upper-cased base name -> next suffix
+    if (!m_fastNaming) {
+      for (const WorkspaceObject& object : objects) {
+        OptionalString name = object.name();
+        if (name && !name->empty()) {
+          nextSuffixes.insert(std::make_pair(boost::to_upper_copy(getBaseName(*name)), 1));
+        }
+      }
+      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+        OptionalString name = p.second->name();
+        if (!name) {
+          continue;
+        }
+        auto it = nextSuffixes.find(boost::to_upper_copy(getBaseName(*name)));
+        if (it != nextSuffixes.end()) {
+          boost::optional<int> suffix = std::get<0>(getNameSuffix(*name));
+          if (suffix && (*suffix >= it->second)) {
+            it->second = *suffix + 1;
+          }
+        }
+      }
+    }
+
+    unsigned n = objects.size();
+    WorkspaceObject_ImplPtrVector newObjects;
+    newObjects.reserve(n * nCopies);
+    std::vector<HandleMap> oldNewHandleMaps(nCopies);
+    std::vector<const HandleMap*> objectHandleMaps;
+    objectHandleMaps.reserve(n * nCopies);
+    for (unsigned k = 0; k < nCopies; ++k) {
+      HandleMap& oldNewHandleMap = oldNewHandleMaps[k];
+      for (const WorkspaceObject& object : objects) {
+        newObjects.push_back(this->createObject(object.getImpl<WorkspaceObject_Impl>(), false));
+        oldNewHandleMap.insert(HandleMap::value_type(object.handle(), newObjects.back()->handle()));
+        objectHandleMaps.push_back(&oldNewHandleMap);
+        OptionalString name = object.name();
+        if (name && !name->empty()) {
+          std::string newName;
+          if (m_fastNaming) {
+            newName = toString(createUUID());
+          } else {
+            std::string baseName = getBaseName(*name);
+            int& suffix = nextSuffixes[boost::to_upper_copy(baseName)];
+            newName = baseName + std::get<1>(getNameSuffix(*name)) + boost::lexical_cast<std::string>(suffix++);
+          }
+          // not yet in the workspace, so bypass the conflict checks of WorkspaceObject_Impl::setName
+          newObjects.back()->IdfObject_Impl::setName(newName, false);
+        }
+      }
+    }
+
+    result = addClones(newObjects, objectHandleMaps, false, UHPointerVector(), HUPointerVector(), true);
+    return result;
+  }
+
   std::vector<WorkspaceObject> Workspace_Impl::insertObjects(const std::vector<WorkspaceObject>& objects) {
     return addAndInsertObjects(WorkspaceObjectVector(), objects);
   }
@@ -1964,6 +2087,19 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::buildNameAndReferenceIndex() {
+    m_nameAndReferenceIndex = std::make_unique<NameAndReferenceIndex>();
+    for (const IdfReferencesMap::value_type& reference : m_idfReferencesMap) {
+      for (const WorkspaceObjectMap::value_type& p : reference.second) {
+        if (OptionalString name = p.second->name()) {
+          // keeps the first object found, as the scan in getObjectByNameAndReference does
+          m_nameAndReferenceIndex->insert(std::make_pair(std::make_pair(reference.first, boost::to_upper_copy(*name)), p.second));
+        }
+      }
+    }
+  }
+
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2521,6 +2657,10 @@ std::vector<WorkspaceObject> Workspace::getObjectsByType(const IddObject& object
   return m_impl->getObjectsByType(objectType);
 }
 
+std::vector<IddObjectType> Workspace::iddObjectTypes() const {
+  return m_impl->iddObjectTypes();
+}
+
 boost::optional<WorkspaceObject> Workspace::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
   return m_impl->getObjectByTypeAndName(objectType, name);
 }
@@ -2576,6 +2716,10 @@ std::vector<WorkspaceObject> Workspace::addObjects(const std::vector<WorkspaceOb
   return m_impl->addObjects(objects, checkNames);
 }
 
+std::vector<WorkspaceObject> Workspace::addCopies(const std::vector<WorkspaceObject>& objects, unsigned nCopies) {
+  return m_impl->addCopies(objects, nCopies);
+}
+
 std::vector<WorkspaceObject> Workspace::insertObjects(const std::vector<WorkspaceObject>& objects) {
   return m_impl->insertObjects(objects);
 }
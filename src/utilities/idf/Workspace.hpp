@@ -204,6 +204,10 @@ class UTILITIES_API Workspace
   /** Returns all objects with .iddObject() == objectType. */
   std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+  /** Returns the distinct IddObjectTypes of the objects currently in the Workspace, in
+   *  IddObjectType order. Each type returned has at least one object. */
+  std::vector<IddObjectType> iddObjectTypes() const;
+
   /** Returns the first object found of type objectType and named name (case insensitive,
    *  exact match). */
   boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const;
@@ -284,6 +288,17 @@ class UTILITIES_API Workspace
    *  \li external object -> objects[i] is not in any way duplicated in result */
   std::vector<WorkspaceObject> addObjects(const std::vector<WorkspaceObject>& objects, bool checkNames = true);
 
+  /** Add nCopies copies of objects, which must all be in this Workspace, in one operation. All
+   *  copies are created, remapped and validated together, and name suffixes are allocated once per
+   *  base name, so this scales to thousands of copies. Upon successful completion, the returned
+   *  vector holds the copies one after the other (result[k * objects.size() + i] is the k-th copy
+   *  of objects[i]). Pointers are handled as follows:
+   *
+   *  \li objects[i] -> objects[j] becomes result[k * n + i] -> result[k * n + j]
+   *  \li objects[i] -> external object becomes result[k * n + i] -> external object
+   *  \li external object -> objects[i] is not in any way duplicated in result */
+  std::vector<WorkspaceObject> addCopies(const std::vector<WorkspaceObject>& objects, unsigned nCopies);
+
   /** Insert objects into this Workspace, if possible. All objects are assumed to be from the same
    *  workspace, possibly this one. Data is only cloned if no equivalent object is located in this
    *  Workspace. Equivalence is defined as dataFieldsEqual and managedObjectListsNonConflicting.
@@ -998,6 +998,10 @@ namespace detail {
       this->onDataChange.nano_emit();
     }
 
+    if (m_workspace) {
+      m_workspace->onObjectChange.nano_emit(handle());
+    }
+
     this->onChange.nano_emit();
 
     m_diffs.clear();
@@ -50,6 +50,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <memory>
 
 namespace openstudio {
 
@@ -178,6 +179,9 @@ namespace detail {
     /// get all idf objects by full idd type
     std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+    /// get the distinct types of the objects currently in the workspace
+    std::vector<IddObjectType> iddObjectTypes() const;
+
     /** Returns the first object found of type objectType and named name (case insensitive,
      *  exact match). */
     boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const;
@@ -267,6 +271,10 @@ namespace detail {
      *  \li external object -> objects[i] is not in any way duplicated in result */
     virtual std::vector<WorkspaceObject> addObjects(const std::vector<WorkspaceObject>& objects, bool checkNames = true);
 
+    /** Add nCopies copies of objects, which must all be in this Workspace. Each copy is remapped
+     *  with its own handle map, but all copies are added to the Workspace by one call to addClones. */
+    virtual std::vector<WorkspaceObject> addCopies(const std::vector<WorkspaceObject>& objects, unsigned nCopies);
+
     /** Insert objects into this Workspace, if possible. All objects are assumed to be from the same
      *  workspace, possibly this one. Data is only cloned if no equivalent object is located in this
      *  Workspace. Equivalence is defined as dataFieldsEqual and managedObjectListsNonConflicting.
@@ -440,6 +448,10 @@ namespace detail {
     // void onChange() const;
     mutable Nano::Signal<void()> onChange;
 
+    /** Emitted after the fields of an object in this Workspace change, with the handle of that object. */
+    // void onObjectChange(const openstudio::UUID& handle) const;
+    mutable Nano::Signal<void(const openstudio::UUID&)> onObjectChange;
+
     /** Send an object being deleted from the workspace. OS_ASSERT(!object.initialized())
      *  should pass, as should OS_ASSERT(object.handle().isNull()). */
     // void removeWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
@@ -495,6 +507,13 @@ namespace detail {
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap;  // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // map of (reference, upper case name) to object, only present while addObjects resolves string pointers so that each
+    // lookup does not scan every object in the reference lists
+    typedef std::unordered_map<std::pair<std::string, std::string>, std::shared_ptr<WorkspaceObject_Impl>,
+                               boost::hash<std::pair<std::string, std::string>>>
+      NameAndReferenceIndex;
+    std::unique_ptr<NameAndReferenceIndex> m_nameAndReferenceIndex;
+
     // data object for undos
     struct SavedWorkspaceObject
     {
@@ -536,11 +555,21 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    // builds m_nameAndReferenceIndex from m_idfReferencesMap
+    void buildNameAndReferenceIndex();
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other, const std::vector<unsigned>& toIgnore);
 
     void mergeIdfObjectAfterPotentialNameConflictResolution(IdfObject& mergedObject, const IdfObject& originalObject) const;
 
+    // Implementation of addClones where objectImplPtrs[i] is remapped with *objectHandleMaps[i]. If
+    // collectionClone, all entries must point to the same map.
+    std::vector<WorkspaceObject> addClones(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs,
+                                           const std::vector<const HandleMap*>& objectHandleMaps, bool collectionClone,
+                                           const std::vector<UHPointer>& pointersIntoWorkspace, const std::vector<HUPointer>& pointersFromWorkspace,
+                                           bool driverMethod);
+
     // Adds provided relationships for newly added objects. handles is conversion from unsigned index
     // to (newly created) handle in workspace.
     bool addProvidedRelationships(const std::vector<Handle>& handles, const std::vector<UHPointer>& pointersIntoWorkspace,
@@ -69,12 +69,24 @@ bool PreparedStatement::bind(int position, double val) {
   return true;
 }
 
+bool PreparedStatement::bindNull(int position) {
+  if (sqlite3_bind_null(m_statement, position) != SQLITE_OK) {
+    return false;
+  }
+  return true;
+}
+
 int PreparedStatement::execute() {
   int code = sqlite3_step(m_statement);
   sqlite3_reset(m_statement);
   return code;
 }
 
+void PreparedStatement::reset() {
+  sqlite3_reset(m_statement);
+  sqlite3_clear_bindings(m_statement);
+}
+
 boost::optional<double> PreparedStatement::execAndReturnFirstDouble() const {
   boost::optional<double> value;
   if (m_db) {
@@ -209,4 +221,42 @@ PreparedStatement::PreparedStatement(PreparedStatement::InternalConstructor, con
 int PreparedStatement::get_sqlite3_bind_parameter_count(sqlite3_stmt* statement) {
   return sqlite3_bind_parameter_count(statement);
 }
+
+PreparedStatementCache::PreparedStatementCache(std::size_t capacity) : m_capacity(capacity > 0 ? capacity : 1) {}
+
+PreparedStatement& PreparedStatementCache::get(const std::string& t_stmt, sqlite3* t_db) {
+  auto it = m_index.find(t_stmt);
+  if (it != m_index.end()) {
+    // move to front, iterators stay valid
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    PreparedStatement& statement = *m_entries.front().second;
+    statement.reset();
+    return statement;
+  }
+
+  // prepare before touching the cache so a bad statement leaves it unchanged
+  auto statement = std::make_unique<PreparedStatement>(t_stmt, t_db);
+
+  if (m_entries.size() >= m_capacity) {
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
+
+  m_entries.emplace_front(t_stmt, std::move(statement));
+  m_index[t_stmt] = m_entries.begin();
+  return *m_entries.front().second;
+}
+
+void PreparedStatementCache::clear() {
+  m_index.clear();
+  m_entries.clear();
+}
+
+std::size_t PreparedStatementCache::size() const {
+  return m_entries.size();
+}
+
+std::size_t PreparedStatementCache::capacity() const {
+  return m_capacity;
+}
 }  // namespace openstudio
@@ -35,8 +35,12 @@
 
 #include <boost/optional.hpp>
 
+#include <list>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 struct sqlite3;
@@ -85,6 +89,8 @@ class UTILITIES_API PreparedStatement
 
   bool bind(int position, double val);
 
+  bool bindNull(int position);
+
   // Makes no sense
   bool bind(int position, char val) = delete;
 
@@ -138,6 +144,9 @@ class UTILITIES_API PreparedStatement
   // Executes a **SINGLE** statement
   int execute();
 
+  /// reset the statement so it can be stepped again from the start and clear all bound values
+  void reset();
+
   [[nodiscard]] boost::optional<double> execAndReturnFirstDouble() const;
 
   [[nodiscard]] boost::optional<int> execAndReturnFirstInt() const;
@@ -158,6 +167,36 @@ class UTILITIES_API PreparedStatement
   [[nodiscard]] boost::optional<std::vector<std::string>> execAndReturnVectorOfString() const;
 };
 
+/** Least recently used cache of PreparedStatements keyed by statement text, so that repeated queries skip
+ *  sqlite3_prepare_v2. Statements are handed out reset with no values bound. All cached statements must be
+ *  cleared before the database they were prepared against is closed. */
+class UTILITIES_API PreparedStatementCache
+{
+ public:
+  explicit PreparedStatementCache(std::size_t capacity = 64);
+
+  PreparedStatementCache& operator=(const PreparedStatementCache&) = delete;
+  PreparedStatementCache(const PreparedStatementCache&) = delete;
+
+  /// return the cached statement for this text, preparing it against t_db on a miss, throws if it cannot be prepared
+  PreparedStatement& get(const std::string& t_stmt, sqlite3* t_db);
+
+  /// finalize all cached statements
+  void clear();
+
+  std::size_t size() const;
+
+  std::size_t capacity() const;
+
+ private:
+  using Entry = std::pair<std::string, std::unique_ptr<PreparedStatement>>;
+
+  std::size_t m_capacity;
+  // most recently used first
+  std::list<Entry> m_entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+};
+
 }  // namespace openstudio
 
 #endif  // UTILITIES_SQL_PREPAREDSTATEMENT_HPP
@@ -37,9 +37,9 @@ namespace openstudio {
 
 SqlFile::SqlFile() {}
 
-SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes) {
+SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes, const bool readOnly) {
   try {
-    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes));
+    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes, readOnly));
   } catch (const std::exception& e) {
     LOG(Error, "Could not create SqlFile for path '" << openstudio::toString(path) << "' error:" << e.what());
   }
@@ -76,6 +76,14 @@ bool SqlFile::connectionOpen() const {
   return result;
 }
 
+bool SqlFile::readOnly() const {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->readOnly();
+  }
+  return result;
+}
+
 openstudio::path SqlFile::path() const {
   openstudio::path result;
   if (m_impl) {
@@ -1001,6 +1009,10 @@ void SqlFile::insertTimeSeriesData(const std::string& t_variableType, const std:
                                t_variableUnits, t_timeSeries);
 }
 
+void SqlFile::insertTimeSeriesData(const std::vector<SqlFileTimeSeriesData>& t_timeSeriesData) {
+  m_impl->insertTimeSeriesData(t_timeSeriesData);
+}
+
 std::vector<std::string> SqlFile::availableReportingFrequencies(const std::string& envPeriod) {
   std::vector<std::string> result;
   if (m_impl) {
@@ -1085,6 +1097,35 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+SqlFileTimeSeriesMatrix SqlFile::timeSeriesMatrix(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                  const std::vector<std::string>& timeSeriesNames, const std::vector<std::string>& keyValues) const {
+  SqlFileTimeSeriesMatrix result;
+  if (m_impl) {
+    result = m_impl->timeSeriesMatrix(envPeriod, reportingFrequency, timeSeriesNames, keyValues);
+  }
+  return result;
+}
+
+bool SqlFile::streamTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames,
+                               const std::vector<std::string>& keyValues,
+                               const std::function<bool(const std::vector<SqlFileTimeSeriesRow>&)>& callback, unsigned batchSize) const {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->streamTimeSeries(envPeriod, reportingFrequency, timeSeriesNames, keyValues, callback, batchSize);
+  }
+  return result;
+}
+
+std::vector<SqlFileTimeSeriesStatistics> SqlFile::timeSeriesStatistics(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                                       const std::vector<std::string>& timeSeriesNames,
+                                                                       const std::vector<std::string>& keyValues) const {
+  std::vector<SqlFileTimeSeriesStatistics> result;
+  if (m_impl) {
+    result = m_impl->timeSeriesStatistics(envPeriod, reportingFrequency, timeSeriesNames, keyValues);
+  }
+  return result;
+}
+
 boost::optional<std::pair<DateTime, DateTime>> SqlFile::daylightSavingsPeriod() const {
   boost::optional<std::pair<DateTime, DateTime>> result;
   if (m_impl) {
@@ -1334,6 +1375,18 @@ std::vector<SummaryData> SqlFile::getSummaryData() const {
   return std::vector<SummaryData>();
 }
 
+bool SqlFile::exportColumnar(const openstudio::path& path, bool compress) const {
+  if (m_impl) {
+    try {
+      m_impl->exportColumnar(path, compress);
+      return true;
+    } catch (const std::exception& e) {
+      LOG(Error, "Could not export '" << openstudio::toString(this->path()) << "' to '" << openstudio::toString(path) << "': " << e.what());
+    }
+  }
+  return false;
+}
+
 /** value (lux) of the illuminance map at hourlyReportIndex
  *  value(i,j) is the illuminance at x(i), y(j) fills in x,y, illuminance*/
 void SqlFile::illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const {
@@ -1342,6 +1395,22 @@ void SqlFile::illuminanceMap(const int& hourlyReportIndex, std::vector<double>&
   }
 }
 
+SqlFileIlluminanceMapData SqlFile::illuminanceMapData(const std::string& name, double threshold) const {
+  SqlFileIlluminanceMapData result;
+  if (m_impl) {
+    result = m_impl->illuminanceMapData(name, threshold);
+  }
+  return result;
+}
+
+SqlFileIlluminanceMapData SqlFile::illuminanceMapData(const int& mapIndex, double threshold) const {
+  SqlFileIlluminanceMapData result;
+  if (m_impl) {
+    result = m_impl->illuminanceMapData(mapIndex, threshold);
+  }
+  return result;
+}
+
 // equality test
 bool SqlFile::operator==(const SqlFile& other) const {
   return (m_impl == other.m_impl);
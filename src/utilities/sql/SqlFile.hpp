@@ -35,6 +35,10 @@
 #include "SummaryData.hpp"
 #include "SqlFileDataDictionary.hpp"
 #include "SqlFileEnums.hpp"
+#include "SqlFileTimeSeriesMatrix.hpp"
+#include "SqlFileTimeSeriesStream.hpp"
+#include "SqlFileTimeSeriesData.hpp"
+#include "SqlFileIlluminanceMapData.hpp"
 #include "SqlFile_Impl.hpp"
 
 #include "../data/Vector.hpp"
@@ -50,6 +54,7 @@
 
 #include <boost/optional.hpp>
 
+#include <functional>
 #include <string>
 
 namespace openstudio {
@@ -76,7 +81,9 @@ class UTILITIES_API SqlFile
 
   /// constructor from path
   /// Creates indexes by default, pass in false for no new indexes and quicker opening
-  explicit SqlFile(const openstudio::path& path, const bool createIndexes = true);
+  /// Pass readOnly = true to open the file without ever writing to it, e.g. to analyze the same file from several
+  /// threads or processes with one SqlFile each. Indexes are then never created, only used if they already exist.
+  explicit SqlFile(const openstudio::path& path, const bool createIndexes = true, const bool readOnly = false);
 
   /// initializes a new sql file for output
   /// Creates indexes by default, pass in false for no indexes and quicker creation
@@ -99,6 +106,9 @@ class UTILITIES_API SqlFile
   /// returns whether or not connection is open
   bool connectionOpen() const;
 
+  /// returns whether the file was opened read-only
+  bool readOnly() const;
+
   /// get the path
   openstudio::path path() const;
 
@@ -690,6 +700,27 @@ class UTILITIES_API SqlFile
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Returns the timeseries for each pair of timeSeriesNames and keyValues in one matrix with a shared time axis,
+   *  fetched with a single query. This is much faster than calling timeSeries for many variables. Columns follow
+   *  the requested order, a timeseries that is not found gives a column of NaN. Throws if timeSeriesNames and
+   *  keyValues differ in size. */
+  SqlFileTimeSeriesMatrix timeSeriesMatrix(const std::string& envPeriod, const std::string& reportingFrequency,
+                                           const std::vector<std::string>& timeSeriesNames, const std::vector<std::string>& keyValues) const;
+
+  /** Reads the values of each pair of timeSeriesNames and keyValues ordered by time and passes them to callback in
+   *  batches of at most batchSize rows, so that very long timestep outputs can be processed in constant memory. Each
+   *  row carries the index of the timeseries it belongs to. Reading stops early if callback returns false. Returns
+   *  false if none of the timeseries were found. Throws if timeSeriesNames and keyValues differ in size. */
+  bool streamTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames,
+                        const std::vector<std::string>& keyValues, const std::function<bool(const std::vector<SqlFileTimeSeriesRow>&)>& callback,
+                        unsigned batchSize = 8760) const;
+
+  /** Returns the sum, minimum, peak with its time and monthly sums of each pair of timeSeriesNames and keyValues,
+   *  computed while streaming the values rather than building TimeSeries. A timeseries that is not found has a count of 0. */
+  std::vector<SqlFileTimeSeriesStatistics> timeSeriesStatistics(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                                const std::vector<std::string>& timeSeriesNames,
+                                                                const std::vector<std::string>& keyValues) const;
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -763,9 +794,19 @@ class UTILITIES_API SqlFile
    *  value(i,j) is the illuminance at x(i), y(j) fills in x,y, illuminance*/
   void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const;
 
+  /** Reads every hourly report of the illuminance map with a single ordered query, instead of several queries per hour,
+   *  and computes the number of hours each point is at or above threshold (lux) and its mean in the same pass.
+   *  Returns an empty result if the map is not found. */
+  SqlFileIlluminanceMapData illuminanceMapData(const std::string& name, double threshold = 300.0) const;
+  SqlFileIlluminanceMapData illuminanceMapData(const int& mapIndex, double threshold = 300.0) const;
+
   /// Returns the summary data for each installlocation and fuel type found in report variables
   std::vector<SummaryData> getSummaryData() const;
 
+  /** Writes the data dictionary, time table and all report data to a compact columnar file that can be loaded
+   *  with SqlFileColumnarReader without opening this file. Chunks are compressed by default. Returns false on failure. */
+  bool exportColumnar(const openstudio::path& path, bool compress = true) const;
+
   int insertZone(const std::string& t_name, double t_relNorth, double t_originX, double t_originY, double t_originZ, double t_centroidX,
                  double t_centroidY, double t_centroidZ, int t_ofType, double t_multiplier, double t_listMultiplier, double t_minimumX,
                  double t_maximumX, double t_minimumY, double t_maximumY, double t_minimumZ, double t_maximumZ, double t_ceilingHeight,
@@ -897,6 +938,9 @@ class UTILITIES_API SqlFile
                             const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
                             const std::string& t_variableUnits, const openstudio::TimeSeries& t_timeSeries);
 
+  /// Inserts many report variables in a single transaction, much faster than calling insertTimeSeriesData for each one
+  void insertTimeSeriesData(const std::vector<SqlFileTimeSeriesData>& t_timeSeriesData);
+
   //@}
   /** @name Operators */
   //@{
@@ -8,6 +8,11 @@
   #include <utilities/sql/SqlFile.hpp>
   #include <utilities/sql/SqlFileEnums.hpp>
   #include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
+  #include <utilities/sql/SqlFileTimeSeriesMatrix.hpp>
+  #include <utilities/sql/SqlFileTimeSeriesStream.hpp>
+  #include <utilities/sql/SqlFileColumnar.hpp>
+  #include <utilities/sql/SqlFileTimeSeriesData.hpp>
+  #include <utilities/sql/SqlFileIlluminanceMapData.hpp>
   #include <utilities/sql/SummaryData.hpp>
 
   #include <utilities/units/Unit.hpp>
@@ -31,6 +36,9 @@
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const std::string&, double&, double&) const;
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const int&, double&, double&) const;
 
+// Takes a C++ callback, use timeSeriesStatistics or timeSeriesMatrix instead
+%ignore openstudio::SqlFile::streamTimeSeries;
+
 // create an instantiation of the optional classes
 %template(OptionalSqlFile) boost::optional<openstudio::SqlFile>;
 %template(OptionalEnvironmentType) boost::optional<openstudio::EnvironmentType>;
@@ -49,8 +57,20 @@
 %template(SummaryDataVector) std::vector<openstudio::SummaryData>;
 
 %template(SqlTimeSeriesQueryVector) std::vector<openstudio::SqlFileTimeSeriesQuery>;
+%template(SqlFileTimeSeriesStatisticsVector) std::vector<openstudio::SqlFileTimeSeriesStatistics>;
+%template(SqlFileColumnarVariableVector) std::vector<openstudio::SqlFileColumnarVariable>;
+
+// Not default-constructible, so ignore vector and resize
+%ignore std::vector<openstudio::SqlFileTimeSeriesData>::vector(size_type);
+%ignore std::vector<openstudio::SqlFileTimeSeriesData>::resize(size_type);
+%template(SqlFileTimeSeriesDataVector) std::vector<openstudio::SqlFileTimeSeriesData>;
 
 %include <utilities/sql/SummaryData.hpp>
+%include <utilities/sql/SqlFileTimeSeriesMatrix.hpp>
+%include <utilities/sql/SqlFileTimeSeriesStream.hpp>
+%include <utilities/sql/SqlFileColumnar.hpp>
+%include <utilities/sql/SqlFileTimeSeriesData.hpp>
+%include <utilities/sql/SqlFileIlluminanceMapData.hpp>
 %include <utilities/sql/SqlFile.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
 %include <utilities/sql/SqlFileEnums.hpp>
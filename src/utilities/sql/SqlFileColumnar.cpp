@@ -0,0 +1,548 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileColumnar.hpp"
+#include "SqlFile_Impl.hpp"
+
+#include "../core/Compare.hpp"
+#include "../core/Filesystem.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <json/json.h>
+#include <sqlite3.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace openstudio {
+
+namespace detail {
+
+  // first and last 8 bytes of every file, the footer JSON and its length precede the end magic
+  constexpr char columnarHeaderMagic[] = "OSCOLV01";
+  constexpr char columnarFooterMagic[] = "OSCOLEND";
+  constexpr size_t columnarMagicSize = 8;
+
+  // values per chunk, each chunk is compressed on its own
+  constexpr size_t columnarChunkRows = 65536;
+
+  template <typename T>
+  const char* columnarType();
+
+  template <>
+  const char* columnarType<int>() {
+    return "int32";
+  }
+
+  template <>
+  const char* columnarType<double>() {
+    return "float64";
+  }
+
+  // groups byte b of every element together, which makes columns of similar numbers compress much better
+  void shuffleBytes(const unsigned char* in, unsigned char* out, size_t numElements, size_t elementSize) {
+    for (size_t i = 0; i < numElements; ++i) {
+      for (size_t b = 0; b < elementSize; ++b) {
+        out[b * numElements + i] = in[i * elementSize + b];
+      }
+    }
+  }
+
+  void unshuffleBytes(const unsigned char* in, unsigned char* out, size_t numElements, size_t elementSize) {
+    for (size_t i = 0; i < numElements; ++i) {
+      for (size_t b = 0; b < elementSize; ++b) {
+        out[i * elementSize + b] = in[b * numElements + i];
+      }
+    }
+  }
+
+  class ColumnarFileWriter
+  {
+   public:
+    ColumnarFileWriter(const openstudio::path& path, bool compress)
+      : m_path(path), m_file(path, std::ios_base::binary | std::ios_base::trunc), m_compress(compress), m_offset(0) {
+      if (!m_file) {
+        throw std::runtime_error("Cannot open '" + toString(m_path) + "' for writing");
+      }
+      write(columnarHeaderMagic, columnarMagicSize);
+    }
+
+    template <typename T>
+    Json::Value writeColumn(const std::vector<T>& values) {
+      Json::Value chunks(Json::arrayValue);
+      for (size_t begin = 0; begin < values.size(); begin += columnarChunkRows) {
+        const size_t rows = std::min(columnarChunkRows, values.size() - begin);
+        const auto* data = reinterpret_cast<const unsigned char*>(values.data() + begin);
+        const uLong rawSize = static_cast<uLong>(rows * sizeof(T));
+
+        Json::Value chunk(Json::objectValue);
+        chunk["offset"] = Json::UInt64(m_offset);
+        chunk["rows"] = Json::UInt64(rows);
+
+        bool compressed = false;
+        if (m_compress) {
+          m_shuffled.resize(rawSize);
+          shuffleBytes(data, m_shuffled.data(), rows, sizeof(T));
+          uLongf compressedSize = compressBound(rawSize);
+          m_compressed.resize(compressedSize);
+          if ((compress2(m_compressed.data(), &compressedSize, m_shuffled.data(), rawSize, Z_BEST_SPEED) == Z_OK) && (compressedSize < rawSize)) {
+            write(reinterpret_cast<const char*>(m_compressed.data()), compressedSize);
+            chunk["size"] = Json::UInt64(compressedSize);
+            compressed = true;
+          }
+        }
+        if (!compressed) {
+          write(reinterpret_cast<const char*>(data), rawSize);
+          chunk["size"] = Json::UInt64(rawSize);
+        }
+        chunk["compressed"] = compressed;
+        chunks.append(chunk);
+      }
+
+      Json::Value column(Json::objectValue);
+      column["type"] = columnarType<T>();
+      column["rows"] = Json::UInt64(values.size());
+      column["chunks"] = chunks;
+      return column;
+    }
+
+    void finish(const Json::Value& footer) {
+      Json::StreamWriterBuilder wbuilder;
+      wbuilder["indentation"] = "";
+      std::string json = Json::writeString(wbuilder, footer);
+      write(json.data(), json.size());
+
+      uint64_t jsonSize = json.size();
+      boost::endian::native_to_little_inplace(jsonSize);
+      write(reinterpret_cast<const char*>(&jsonSize), sizeof(jsonSize));
+      write(columnarFooterMagic, columnarMagicSize);
+
+      m_file.close();
+      if (!m_file) {
+        throw std::runtime_error("Error writing '" + toString(m_path) + "'");
+      }
+    }
+
+   private:
+    void write(const char* data, size_t size) {
+      m_file.write(data, size);
+      if (!m_file) {
+        throw std::runtime_error("Error writing '" + toString(m_path) + "'");
+      }
+      m_offset += size;
+    }
+
+    openstudio::path m_path;
+    openstudio::filesystem::ofstream m_file;
+    bool m_compress;
+    uint64_t m_offset;
+    std::vector<unsigned char> m_shuffled;
+    std::vector<unsigned char> m_compressed;
+  };
+
+  std::string columnarText(sqlite3_stmt* statement, int column) {
+    const unsigned char* text = sqlite3_column_text(statement, column);
+    return text ? std::string(reinterpret_cast<const char*>(text)) : std::string();
+  }
+
+  sqlite3_stmt* prepareColumnarQuery(sqlite3* db, const std::string& query) {
+    sqlite3_stmt* statement = nullptr;
+    if (sqlite3_prepare_v2(db, query.c_str(), -1, &statement, nullptr) != SQLITE_OK) {
+      sqlite3_finalize(statement);
+      throw std::runtime_error("Error creating prepared statement: " + query + ", errmsg: " + sqlite3_errmsg(db));
+    }
+    return statement;
+  }
+
+  void exportColumnarReportData(sqlite3* db, bool hasYear, const std::string& energyPlusVersion, const openstudio::path& path, bool compress) {
+    if (!db) {
+      throw std::runtime_error("Database connection is not open");
+    }
+
+    ColumnarFileWriter writer(path, compress);
+
+    Json::Value footer(Json::objectValue);
+    footer["format"] = "OpenStudioColumnarReportData";
+    footer["version"] = 1;
+    // column chunks are written in native byte order
+    footer["littleEndian"] = (boost::endian::order::native == boost::endian::order::little);
+    footer["energyPlusVersion"] = energyPlusVersion;
+    footer["hasYear"] = hasYear;
+
+    Json::Value envPeriods(Json::arrayValue);
+    sqlite3_stmt* statement = prepareColumnarQuery(db, "SELECT EnvironmentPeriodIndex, EnvironmentName FROM EnvironmentPeriods");
+    while (sqlite3_step(statement) == SQLITE_ROW) {
+      Json::Value envPeriod(Json::objectValue);
+      envPeriod["index"] = sqlite3_column_int(statement, 0);
+      envPeriod["name"] = columnarText(statement, 1);
+      envPeriods.append(envPeriod);
+    }
+    sqlite3_finalize(statement);
+    footer["environmentPeriods"] = envPeriods;
+
+    // the time table is small, one column per field
+    std::vector<int> timeIndex, year, month, day, hour, minute, interval, envPeriodIndex;
+    std::stringstream s;
+    s << "SELECT TimeIndex, " << (hasYear ? "Year" : "0")
+      << ", Month, Day, Hour, Minute, Interval, EnvironmentPeriodIndex FROM Time ORDER BY TimeIndex";
+    statement = prepareColumnarQuery(db, s.str());
+    while (sqlite3_step(statement) == SQLITE_ROW) {
+      int b = 0;
+      timeIndex.push_back(sqlite3_column_int(statement, b++));
+      year.push_back(sqlite3_column_int(statement, b++));
+      month.push_back(sqlite3_column_int(statement, b++));
+      day.push_back(sqlite3_column_int(statement, b++));
+      hour.push_back(sqlite3_column_int(statement, b++));
+      minute.push_back(sqlite3_column_int(statement, b++));
+      interval.push_back(sqlite3_column_int(statement, b++));
+      envPeriodIndex.push_back(sqlite3_column_int(statement, b++));
+    }
+    sqlite3_finalize(statement);
+
+    Json::Value time(Json::objectValue);
+    time["TimeIndex"] = writer.writeColumn(timeIndex);
+    time["Year"] = writer.writeColumn(year);
+    time["Month"] = writer.writeColumn(month);
+    time["Day"] = writer.writeColumn(day);
+    time["Hour"] = writer.writeColumn(hour);
+    time["Minute"] = writer.writeColumn(minute);
+    time["Interval"] = writer.writeColumn(interval);
+    time["EnvironmentPeriodIndex"] = writer.writeColumn(envPeriodIndex);
+    footer["time"] = time;
+
+    // walk the dictionary and the data together, both ordered by dictionary index, so only one variable is held at a time
+    sqlite3_stmt* dictionary = prepareColumnarQuery(
+      db, "SELECT ReportDataDictionaryIndex, IsMeter, Name, KeyValue, ReportingFrequency, Units FROM ReportDataDictionary ORDER BY "
+          "ReportDataDictionaryIndex");
+    sqlite3_stmt* data =
+      prepareColumnarQuery(db, "SELECT ReportDataDictionaryIndex, TimeIndex, Value FROM ReportData ORDER BY ReportDataDictionaryIndex, TimeIndex");
+
+    Json::Value variables(Json::arrayValue);
+    std::vector<int> variableTimeIndices;
+    std::vector<double> variableValues;
+    try {
+      int dataCode = sqlite3_step(data);
+      while (sqlite3_step(dictionary) == SQLITE_ROW) {
+        const int dictionaryIndex = sqlite3_column_int(dictionary, 0);
+
+        variableTimeIndices.clear();
+        variableValues.clear();
+        while ((dataCode == SQLITE_ROW) && (sqlite3_column_int(data, 0) <= dictionaryIndex)) {
+          if (sqlite3_column_int(data, 0) == dictionaryIndex) {
+            variableTimeIndices.push_back(sqlite3_column_int(data, 1));
+            variableValues.push_back(sqlite3_column_double(data, 2));
+          }
+          dataCode = sqlite3_step(data);
+        }
+
+        Json::Value variable(Json::objectValue);
+        variable["dictionaryIndex"] = dictionaryIndex;
+        variable["isMeter"] = (sqlite3_column_int(dictionary, 1) != 0);
+        variable["name"] = columnarText(dictionary, 2);
+        variable["keyValue"] = columnarText(dictionary, 3);
+        variable["reportingFrequency"] = columnarText(dictionary, 4);
+        variable["units"] = columnarText(dictionary, 5);
+        variable["TimeIndex"] = writer.writeColumn(variableTimeIndices);
+        variable["Value"] = writer.writeColumn(variableValues);
+        variables.append(variable);
+      }
+    } catch (...) {
+      sqlite3_finalize(dictionary);
+      sqlite3_finalize(data);
+      throw;
+    }
+    sqlite3_finalize(dictionary);
+    sqlite3_finalize(data);
+    footer["variables"] = variables;
+
+    writer.finish(footer);
+  }
+
+  class SqlFileColumnarReader_Impl
+  {
+   public:
+    explicit SqlFileColumnarReader_Impl(const openstudio::path& path) : m_path(path) {
+      if (!openstudio::filesystem::is_regular_file(m_path)) {
+        throw std::runtime_error("'" + toString(m_path) + "' is not a file");
+      }
+      m_file.open(m_path);
+      const char* begin = m_file.data();
+      const size_t size = m_file.size();
+
+      const size_t trailerSize = sizeof(uint64_t) + columnarMagicSize;
+      if ((size < columnarMagicSize + trailerSize) || (std::memcmp(begin, columnarHeaderMagic, columnarMagicSize) != 0)
+          || (std::memcmp(begin + size - columnarMagicSize, columnarFooterMagic, columnarMagicSize) != 0)) {
+        throw std::runtime_error("'" + toString(m_path) + "' is not a columnar report data file");
+      }
+
+      uint64_t jsonSize = 0;
+      std::memcpy(&jsonSize, begin + size - trailerSize, sizeof(jsonSize));
+      boost::endian::little_to_native_inplace(jsonSize);
+      if (jsonSize > size - columnarMagicSize - trailerSize) {
+        throw std::runtime_error("'" + toString(m_path) + "' has a corrupt footer");
+      }
+
+      Json::CharReaderBuilder rbuilder;
+      std::unique_ptr<Json::CharReader> reader(rbuilder.newCharReader());
+      const char* jsonBegin = begin + size - trailerSize - jsonSize;
+      std::string formattedErrors;
+      if (!reader->parse(jsonBegin, jsonBegin + jsonSize, &m_footer, &formattedErrors)) {
+        throw std::runtime_error("'" + toString(m_path) + "' has a corrupt footer: " + formattedErrors);
+      }
+      if (m_footer.get("version", 0).asInt() != 1) {
+        throw std::runtime_error("'" + toString(m_path) + "' has an unsupported version");
+      }
+      if (m_footer["littleEndian"].asBool() != (boost::endian::order::native == boost::endian::order::little)) {
+        throw std::runtime_error("'" + toString(m_path) + "' was written with a different byte order");
+      }
+
+      for (const auto& envPeriod : m_footer["environmentPeriods"]) {
+        m_envPeriods.emplace_back(envPeriod["index"].asInt(), boost::to_upper_copy(envPeriod["name"].asString()));
+      }
+
+      const Json::Value& time = m_footer["time"];
+      m_timeIndex = readColumn<int>(time["TimeIndex"]);
+      m_year = readColumn<int>(time["Year"]);
+      m_month = readColumn<int>(time["Month"]);
+      m_day = readColumn<int>(time["Day"]);
+      m_hour = readColumn<int>(time["Hour"]);
+      m_minute = readColumn<int>(time["Minute"]);
+      m_interval = readColumn<int>(time["Interval"]);
+      m_envPeriodIndex = readColumn<int>(time["EnvironmentPeriodIndex"]);
+
+      for (const auto& v : m_footer["variables"]) {
+        SqlFileColumnarVariable variable;
+        variable.dictionaryIndex = v["dictionaryIndex"].asInt();
+        variable.isMeter = v["isMeter"].asBool();
+        variable.name = v["name"].asString();
+        variable.keyValue = v["keyValue"].asString();
+        variable.reportingFrequency = v["reportingFrequency"].asString();
+        variable.units = v["units"].asString();
+        variable.numValues = v["Value"]["rows"].asUInt();
+        m_variables.push_back(variable);
+      }
+    }
+
+    openstudio::path path() const {
+      return m_path;
+    }
+
+    std::string energyPlusVersion() const {
+      return m_footer["energyPlusVersion"].asString();
+    }
+
+    std::vector<std::string> availableEnvPeriods() const {
+      std::vector<std::string> result;
+      for (const auto& envPeriod : m_envPeriods) {
+        result.push_back(envPeriod.second);
+      }
+      return result;
+    }
+
+    const std::vector<SqlFileColumnarVariable>& variables() const {
+      return m_variables;
+    }
+
+    std::vector<int> timeIndices(unsigned variableIndex) const {
+      return readColumn<int>(variableJson(variableIndex)["TimeIndex"]);
+    }
+
+    std::vector<double> values(unsigned variableIndex) const {
+      return readColumn<double>(variableJson(variableIndex)["Value"]);
+    }
+
+    boost::optional<TimeSeries> timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName,
+                                           const std::string& keyValue) const {
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+      auto envIt = std::find_if(m_envPeriods.begin(), m_envPeriods.end(), [&](const auto& p) { return p.second == queryEnvPeriod; });
+      if (envIt == m_envPeriods.end()) {
+        return boost::none;
+      }
+
+      auto it = std::find_if(m_variables.begin(), m_variables.end(), [&](const SqlFileColumnarVariable& v) {
+        return (v.reportingFrequency == reportingFrequency) && (v.name == timeSeriesName) && istringEqual(v.keyValue, keyValue);
+      });
+      if (it == m_variables.end()) {
+        return boost::none;
+      }
+      const unsigned variableIndex = it - m_variables.begin();
+
+      std::vector<int> variableTimeIndices = timeIndices(variableIndex);
+      std::vector<double> variableValues = values(variableIndex);
+
+      const int envPeriodIndex = envIt->first;
+      ReportDataTimeSeriesBuilder builder(
+        it->reportingFrequency, energyPlusVersion(), [this, envPeriodIndex]() { return envPeriodDateTime(envPeriodIndex, true); },
+        [this, envPeriodIndex]() { return envPeriodDateTime(envPeriodIndex, false); });
+      for (size_t i = 0; i < variableTimeIndices.size(); ++i) {
+        auto row = std::lower_bound(m_timeIndex.begin(), m_timeIndex.end(), variableTimeIndices[i]);
+        if ((row == m_timeIndex.end()) || (*row != variableTimeIndices[i])) {
+          continue;
+        }
+        const size_t r = row - m_timeIndex.begin();
+        if (m_envPeriodIndex[r] != envPeriodIndex) {
+          continue;
+        }
+        // sizing periods have year 0, same as SqlFile::timeSeries
+        boost::optional<unsigned> year;
+        if (m_year[r] > 0) {
+          year = m_year[r];
+        }
+        builder.addRow(variableValues[i], year, m_month[r], m_day[r], m_interval[r]);
+      }
+
+      return builder.timeSeries(it->units);
+    }
+
+   private:
+    // first or last dated row of the environment period, same as SqlFile_Impl::firstDateTime and lastDateTime without hour and minute
+    DateTime envPeriodDateTime(int envPeriodIndex, bool first) const {
+      boost::optional<unsigned> year;
+      unsigned month = 1, day = 1;
+      for (size_t r = 0; r < m_timeIndex.size(); ++r) {
+        if ((m_envPeriodIndex[r] != envPeriodIndex) || (m_month[r] == 0) || (m_day[r] == 0)) {
+          continue;
+        }
+        if (m_footer["hasYear"].asBool()) {
+          year = m_year[r];
+        }
+        month = m_month[r];
+        day = m_day[r];
+        if (first) {
+          break;
+        }
+      }
+      Date date = year ? Date(monthOfYear(month), day, *year) : Date(monthOfYear(month), day);
+      return DateTime(date, Time(0, first ? 1 : 24, 0, 0));
+    }
+
+    const Json::Value& variableJson(unsigned variableIndex) const {
+      if (variableIndex >= m_variables.size()) {
+        throw std::out_of_range("Variable index out of range");
+      }
+      return m_footer["variables"][variableIndex];
+    }
+
+    template <typename T>
+    std::vector<T> readColumn(const Json::Value& column) const {
+      if (column["type"].asString() != columnarType<T>()) {
+        throw std::runtime_error("Unexpected column type in '" + toString(m_path) + "'");
+      }
+
+      std::vector<T> result(column["rows"].asUInt64());
+      std::vector<unsigned char> shuffled;
+      size_t row = 0;
+      for (const auto& chunk : column["chunks"]) {
+        const uint64_t offset = chunk["offset"].asUInt64();
+        const uint64_t size = chunk["size"].asUInt64();
+        const size_t rows = chunk["rows"].asUInt64();
+        if ((offset + size > m_file.size()) || (row + rows > result.size())) {
+          throw std::runtime_error("'" + toString(m_path) + "' has a corrupt chunk");
+        }
+
+        const auto* data = reinterpret_cast<const unsigned char*>(m_file.data() + offset);
+        auto* out = reinterpret_cast<unsigned char*>(result.data() + row);
+        uLongf rawSize = static_cast<uLongf>(rows * sizeof(T));
+        if (chunk["compressed"].asBool()) {
+          shuffled.resize(rawSize);
+          if ((uncompress(shuffled.data(), &rawSize, data, static_cast<uLong>(size)) != Z_OK) || (rawSize != rows * sizeof(T))) {
+            throw std::runtime_error("'" + toString(m_path) + "' has a corrupt chunk");
+          }
+          unshuffleBytes(shuffled.data(), out, rows, sizeof(T));
+        } else {
+          if (size != rawSize) {
+            throw std::runtime_error("'" + toString(m_path) + "' has a corrupt chunk");
+          }
+          std::memcpy(out, data, rawSize);
+        }
+        row += rows;
+      }
+      if (row != result.size()) {
+        throw std::runtime_error("'" + toString(m_path) + "' has a corrupt column");
+      }
+      return result;
+    }
+
+    openstudio::path m_path;
+    boost::iostreams::mapped_file_source m_file;
+    Json::Value m_footer;
+    std::vector<std::pair<int, std::string>> m_envPeriods;
+    std::vector<SqlFileColumnarVariable> m_variables;
+    std::vector<int> m_timeIndex;
+    std::vector<int> m_year;
+    std::vector<int> m_month;
+    std::vector<int> m_day;
+    std::vector<int> m_hour;
+    std::vector<int> m_minute;
+    std::vector<int> m_interval;
+    std::vector<int> m_envPeriodIndex;
+  };
+
+}  // namespace detail
+
+SqlFileColumnarReader::SqlFileColumnarReader(const openstudio::path& path)
+  : m_impl(std::make_shared<detail::SqlFileColumnarReader_Impl>(path)) {}
+
+openstudio::path SqlFileColumnarReader::path() const {
+  return m_impl->path();
+}
+
+std::string SqlFileColumnarReader::energyPlusVersion() const {
+  return m_impl->energyPlusVersion();
+}
+
+std::vector<std::string> SqlFileColumnarReader::availableEnvPeriods() const {
+  return m_impl->availableEnvPeriods();
+}
+
+const std::vector<SqlFileColumnarVariable>& SqlFileColumnarReader::variables() const {
+  return m_impl->variables();
+}
+
+std::vector<int> SqlFileColumnarReader::timeIndices(unsigned variableIndex) const {
+  return m_impl->timeIndices(variableIndex);
+}
+
+std::vector<double> SqlFileColumnarReader::values(unsigned variableIndex) const {
+  return m_impl->values(variableIndex);
+}
+
+boost::optional<TimeSeries> SqlFileColumnarReader::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                              const std::string& timeSeriesName, const std::string& keyValue) const {
+  return m_impl->timeSeries(envPeriod, reportingFrequency, timeSeriesName, keyValue);
+}
+
+}  // namespace openstudio
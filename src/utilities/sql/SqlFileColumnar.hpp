@@ -0,0 +1,99 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILECOLUMNAR_HPP
+#define UTILITIES_SQL_SQLFILECOLUMNAR_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "../core/Path.hpp"
+#include "../data/TimeSeries.hpp"
+
+#include <boost/optional.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+/** One report variable or meter stored in a columnar report data file. */
+struct UTILITIES_API SqlFileColumnarVariable
+{
+  int dictionaryIndex = 0;
+  bool isMeter = false;
+  std::string name;
+  std::string keyValue;
+  std::string reportingFrequency;
+  std::string units;
+  /// number of values over all environment periods
+  unsigned numValues = 0;
+};
+
+namespace detail {
+
+  class SqlFileColumnarReader_Impl;
+
+}  // namespace detail
+
+/** SqlFileColumnarReader reads report data written by SqlFile::exportColumnar. The file starts with a magic
+ *  header, followed by column chunks that are byte shuffled and zlib compressed unless that does not make them
+ *  smaller, and ends with a JSON footer indexing every chunk. The file is memory-mapped and only the footer and
+ *  time table are decoded on open, value columns are decoded from the mapping when requested. */
+class UTILITIES_API SqlFileColumnarReader
+{
+ public:
+  /// throws if the file cannot be mapped or is not a columnar report data file
+  explicit SqlFileColumnarReader(const openstudio::path& path);
+
+  openstudio::path path() const;
+
+  std::string energyPlusVersion() const;
+
+  /// environment period names, upper case as in SqlFile::availableEnvPeriods
+  std::vector<std::string> availableEnvPeriods() const;
+
+  const std::vector<SqlFileColumnarVariable>& variables() const;
+
+  /// time indices of all values of variables()[variableIndex], throws if out of range
+  std::vector<int> timeIndices(unsigned variableIndex) const;
+
+  /// all values of variables()[variableIndex], throws if out of range
+  std::vector<double> values(unsigned variableIndex) const;
+
+  /// same lookup and result as SqlFile::timeSeries, without opening the sql file
+  boost::optional<TimeSeries> timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName,
+                                         const std::string& keyValue) const;
+
+ private:
+  std::shared_ptr<detail::SqlFileColumnarReader_Impl> m_impl;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILECOLUMNAR_HPP
@@ -0,0 +1,141 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileIlluminanceMapData.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace openstudio {
+
+SqlFileIlluminanceMapData::SqlFileIlluminanceMapData() : m_threshold(0.0) {}
+
+SqlFileIlluminanceMapData::SqlFileIlluminanceMapData(const std::vector<DateTime>& dateTimes, const std::vector<double>& x,
+                                                     const std::vector<double>& y, const std::vector<double>& values, double threshold)
+  : m_dateTimes(dateTimes), m_x(x), m_y(y), m_values(values), m_threshold(threshold) {
+  const size_t numPoints = m_x.size() * m_y.size();
+  if (m_values.size() != m_dateTimes.size() * numPoints) {
+    throw std::runtime_error("Number of values does not match number of date times times number of points");
+  }
+
+  m_hoursAboveThreshold.assign(numPoints, 0);
+  m_meanIlluminance.assign(numPoints, 0.0);
+  std::vector<unsigned> counts(numPoints, 0);
+  for (size_t h = 0; h < m_dateTimes.size(); ++h) {
+    const double* frame = m_values.data() + h * numPoints;
+    for (size_t p = 0; p < numPoints; ++p) {
+      if (!std::isnan(frame[p])) {
+        ++counts[p];
+        m_meanIlluminance[p] += frame[p];
+        if (frame[p] >= m_threshold) {
+          ++m_hoursAboveThreshold[p];
+        }
+      }
+    }
+  }
+  for (size_t p = 0; p < numPoints; ++p) {
+    m_meanIlluminance[p] = (counts[p] > 0) ? m_meanIlluminance[p] / counts[p] : std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+SqlFileIlluminanceMapData::SqlFileIlluminanceMapData(std::vector<DateTime> dateTimes, std::vector<double> x, std::vector<double> y,
+                                                     std::vector<double> values, double threshold, std::vector<unsigned> hoursAboveThreshold,
+                                                     std::vector<double> meanIlluminance)
+  : m_dateTimes(std::move(dateTimes)),
+    m_x(std::move(x)),
+    m_y(std::move(y)),
+    m_values(std::move(values)),
+    m_threshold(threshold),
+    m_hoursAboveThreshold(std::move(hoursAboveThreshold)),
+    m_meanIlluminance(std::move(meanIlluminance)) {}
+
+const std::vector<DateTime>& SqlFileIlluminanceMapData::dateTimes() const {
+  return m_dateTimes;
+}
+
+const std::vector<double>& SqlFileIlluminanceMapData::x() const {
+  return m_x;
+}
+
+const std::vector<double>& SqlFileIlluminanceMapData::y() const {
+  return m_y;
+}
+
+const std::vector<double>& SqlFileIlluminanceMapData::values() const {
+  return m_values;
+}
+
+unsigned SqlFileIlluminanceMapData::numHours() const {
+  return m_dateTimes.size();
+}
+
+unsigned SqlFileIlluminanceMapData::numX() const {
+  return m_x.size();
+}
+
+unsigned SqlFileIlluminanceMapData::numY() const {
+  return m_y.size();
+}
+
+double SqlFileIlluminanceMapData::value(unsigned hour, unsigned xIndex, unsigned yIndex) const {
+  if ((hour >= numHours()) || (xIndex >= numX()) || (yIndex >= numY())) {
+    throw std::out_of_range("Hour or point out of range");
+  }
+  return m_values[(static_cast<size_t>(hour) * m_y.size() + yIndex) * m_x.size() + xIndex];
+}
+
+Matrix SqlFileIlluminanceMapData::illuminanceMap(unsigned hour) const {
+  if (hour >= numHours()) {
+    throw std::out_of_range("Hour out of range");
+  }
+  Matrix result(m_x.size(), m_y.size());
+  const double* frame = m_values.data() + static_cast<size_t>(hour) * m_x.size() * m_y.size();
+  for (size_t j = 0; j < m_y.size(); ++j) {
+    for (size_t i = 0; i < m_x.size(); ++i) {
+      result(i, j) = frame[j * m_x.size() + i];
+    }
+  }
+  return result;
+}
+
+double SqlFileIlluminanceMapData::threshold() const {
+  return m_threshold;
+}
+
+const std::vector<unsigned>& SqlFileIlluminanceMapData::hoursAboveThreshold() const {
+  return m_hoursAboveThreshold;
+}
+
+const std::vector<double>& SqlFileIlluminanceMapData::meanIlluminance() const {
+  return m_meanIlluminance;
+}
+
+}  // namespace openstudio
@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILEILLUMINANCEMAPDATA_HPP
+#define UTILITIES_SQL_SQLFILEILLUMINANCEMAPDATA_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "../time/DateTime.hpp"
+#include "../data/Matrix.hpp"
+
+#include <vector>
+
+namespace openstudio {
+
+namespace detail {
+  class SqlFile_Impl;
+}
+
+/** SqlFileIlluminanceMapData holds every hourly report of one illuminance map in a single contiguous array, indexed
+ *  by hour, then y, then x, so value(h, i, j) is stored at values()[(h * numY() + j) * numX() + i]. Points that were
+ *  not reported at a given hour are NaN. Per point metrics over all hours are stored in the same y then x order. */
+class UTILITIES_API SqlFileIlluminanceMapData
+{
+ public:
+  /// empty map
+  SqlFileIlluminanceMapData();
+
+  /// computes the per point metrics from values, throws if values does not have dateTimes.size() * y.size() * x.size() entries
+  SqlFileIlluminanceMapData(const std::vector<DateTime>& dateTimes, const std::vector<double>& x, const std::vector<double>& y,
+                            const std::vector<double>& values, double threshold);
+
+  /// date and time of each hourly report
+  const std::vector<DateTime>& dateTimes() const;
+
+  /// x position (m) of each column of the map, ascending
+  const std::vector<double>& x() const;
+
+  /// y position (m) of each row of the map, ascending
+  const std::vector<double>& y() const;
+
+  /// all values (lux), hour then y then x
+  const std::vector<double>& values() const;
+
+  unsigned numHours() const;
+
+  unsigned numX() const;
+
+  unsigned numY() const;
+
+  /// value (lux) at x(xIndex), y(yIndex) for the given hour, throws if out of range
+  double value(unsigned hour, unsigned xIndex, unsigned yIndex) const;
+
+  /** copy of the map at the given hour in the layout of SqlFile::illuminanceMap,
+   *  value(i,j) is the illuminance at x(i), y(j), throws if out of range */
+  Matrix illuminanceMap(unsigned hour) const;
+
+  /// illuminance (lux) used for hoursAboveThreshold
+  double threshold() const;
+
+  /// number of hours each point is at or above threshold, y then x
+  const std::vector<unsigned>& hoursAboveThreshold() const;
+
+  /// mean illuminance (lux) of each point over all reported hours, y then x
+  const std::vector<double>& meanIlluminance() const;
+
+ private:
+  friend class detail::SqlFile_Impl;
+
+  /// takes metrics accumulated while reading values
+  SqlFileIlluminanceMapData(std::vector<DateTime> dateTimes, std::vector<double> x, std::vector<double> y, std::vector<double> values,
+                            double threshold, std::vector<unsigned> hoursAboveThreshold, std::vector<double> meanIlluminance);
+
+  std::vector<DateTime> m_dateTimes;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_values;
+  double m_threshold;
+  std::vector<unsigned> m_hoursAboveThreshold;
+  std::vector<double> m_meanIlluminance;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILEILLUMINANCEMAPDATA_HPP
@@ -0,0 +1,93 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileTimeSeriesMatrix.hpp"
+
+#include <stdexcept>
+
+namespace openstudio {
+
+SqlFileTimeSeriesMatrix::SqlFileTimeSeriesMatrix() = default;
+
+SqlFileTimeSeriesMatrix::SqlFileTimeSeriesMatrix(const std::vector<DateTime>& dateTimes, const std::vector<std::string>& variableNames,
+                                                 const std::vector<std::string>& keyValues, const std::vector<std::string>& units,
+                                                 const std::vector<double>& values)
+  : m_dateTimes(dateTimes), m_variableNames(variableNames), m_keyValues(keyValues), m_units(units), m_values(values) {
+  if ((m_keyValues.size() != m_variableNames.size()) || (m_units.size() != m_variableNames.size())) {
+    throw std::runtime_error("Number of variable names, key values and units do not match");
+  }
+  if (m_values.size() != m_dateTimes.size() * m_variableNames.size()) {
+    throw std::runtime_error("Number of values does not match number of date times times number of variables");
+  }
+}
+
+const std::vector<DateTime>& SqlFileTimeSeriesMatrix::dateTimes() const {
+  return m_dateTimes;
+}
+
+const std::vector<std::string>& SqlFileTimeSeriesMatrix::variableNames() const {
+  return m_variableNames;
+}
+
+const std::vector<std::string>& SqlFileTimeSeriesMatrix::keyValues() const {
+  return m_keyValues;
+}
+
+const std::vector<std::string>& SqlFileTimeSeriesMatrix::units() const {
+  return m_units;
+}
+
+const std::vector<double>& SqlFileTimeSeriesMatrix::values() const {
+  return m_values;
+}
+
+unsigned SqlFileTimeSeriesMatrix::numRows() const {
+  return m_dateTimes.size();
+}
+
+unsigned SqlFileTimeSeriesMatrix::numColumns() const {
+  return m_variableNames.size();
+}
+
+double SqlFileTimeSeriesMatrix::value(unsigned row, unsigned column) const {
+  if ((row >= numRows()) || (column >= numColumns())) {
+    throw std::out_of_range("Row or column out of range");
+  }
+  return m_values[column * m_dateTimes.size() + row];
+}
+
+std::vector<double> SqlFileTimeSeriesMatrix::column(unsigned column) const {
+  if (column >= numColumns()) {
+    throw std::out_of_range("Column out of range");
+  }
+  auto begin = m_values.begin() + column * m_dateTimes.size();
+  return std::vector<double>(begin, begin + m_dateTimes.size());
+}
+
+}  // namespace openstudio
@@ -0,0 +1,87 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESMATRIX_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESMATRIX_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "../time/DateTime.hpp"
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+/** SqlFileTimeSeriesMatrix holds several timeseries of one environment period and reporting frequency that share a
+ *  single time axis. Values are stored column-major, column j holds numRows() contiguous values for variableNames()[j]
+ *  and keyValues()[j]. Values that were not reported at a given time, or for a timeseries that was not found, are NaN. */
+class UTILITIES_API SqlFileTimeSeriesMatrix
+{
+ public:
+  /// empty matrix
+  SqlFileTimeSeriesMatrix();
+
+  /// values must be column-major with dateTimes.size() * variableNames.size() entries, throws otherwise
+  SqlFileTimeSeriesMatrix(const std::vector<DateTime>& dateTimes, const std::vector<std::string>& variableNames,
+                          const std::vector<std::string>& keyValues, const std::vector<std::string>& units, const std::vector<double>& values);
+
+  /// shared time axis, one entry per row
+  const std::vector<DateTime>& dateTimes() const;
+
+  const std::vector<std::string>& variableNames() const;
+
+  const std::vector<std::string>& keyValues() const;
+
+  /// units of each column, empty if the timeseries was not found
+  const std::vector<std::string>& units() const;
+
+  /// all values in column-major order
+  const std::vector<double>& values() const;
+
+  unsigned numRows() const;
+
+  unsigned numColumns() const;
+
+  /// value at row and column, throws if out of range
+  double value(unsigned row, unsigned column) const;
+
+  /// copy of the values of one column, throws if out of range
+  std::vector<double> column(unsigned column) const;
+
+ private:
+  std::vector<DateTime> m_dateTimes;
+  std::vector<std::string> m_variableNames;
+  std::vector<std::string> m_keyValues;
+  std::vector<std::string> m_units;
+  std::vector<double> m_values;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILETIMESERIESMATRIX_HPP
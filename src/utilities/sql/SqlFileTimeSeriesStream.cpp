@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileTimeSeriesStream.hpp"
+
+namespace openstudio {
+
+boost::optional<DateTime> SqlFileTimeSeriesRow::dateTime() const {
+  if ((month == 0) || (day == 0)) {
+    return boost::none;
+  }
+  Date date = (year > 0) ? Date(monthOfYear(month), day, year) : Date(monthOfYear(month), day);
+  return DateTime(date, Time(0, hour, minute, 0));
+}
+
+SqlFileTimeSeriesStatistics::SqlFileTimeSeriesStatistics() : m_count(0), m_sum(0.0), m_minimum(0.0), m_monthlySums(12, 0.0) {}
+
+void SqlFileTimeSeriesStatistics::add(const SqlFileTimeSeriesRow& row) {
+  if (m_count == 0) {
+    m_minimum = row.value;
+    m_peak = row;
+  } else {
+    if (row.value < m_minimum) {
+      m_minimum = row.value;
+    }
+    if (row.value > m_peak.value) {
+      m_peak = row;
+    }
+  }
+  ++m_count;
+  m_sum += row.value;
+  if ((row.month >= 1) && (row.month <= 12)) {
+    m_monthlySums[row.month - 1] += row.value;
+  }
+}
+
+unsigned SqlFileTimeSeriesStatistics::count() const {
+  return m_count;
+}
+
+double SqlFileTimeSeriesStatistics::sum() const {
+  return m_sum;
+}
+
+boost::optional<double> SqlFileTimeSeriesStatistics::mean() const {
+  if (m_count == 0) {
+    return boost::none;
+  }
+  return m_sum / m_count;
+}
+
+boost::optional<double> SqlFileTimeSeriesStatistics::minimum() const {
+  if (m_count == 0) {
+    return boost::none;
+  }
+  return m_minimum;
+}
+
+boost::optional<double> SqlFileTimeSeriesStatistics::maximum() const {
+  if (m_count == 0) {
+    return boost::none;
+  }
+  return m_peak.value;
+}
+
+boost::optional<DateTime> SqlFileTimeSeriesStatistics::peakDateTime() const {
+  if (m_count == 0) {
+    return boost::none;
+  }
+  return m_peak.dateTime();
+}
+
+const std::vector<double>& SqlFileTimeSeriesStatistics::monthlySums() const {
+  return m_monthlySums;
+}
+
+}  // namespace openstudio
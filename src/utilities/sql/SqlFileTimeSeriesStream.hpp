@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESSTREAM_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESSTREAM_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "../time/DateTime.hpp"
+
+#include <boost/optional.hpp>
+
+#include <vector>
+
+namespace openstudio {
+
+/** One value read by SqlFile::streamTimeSeries. The time fields are the raw values of the Time table, the
+ *  DateTime is only built on request. */
+struct UTILITIES_API SqlFileTimeSeriesRow
+{
+  /// index of the requested timeseries this value belongs to
+  unsigned column = 0;
+  int timeIndex = 0;
+  /// 0 if the file does not report years or for sizing periods
+  int year = 0;
+  unsigned month = 0;
+  unsigned day = 0;
+  unsigned hour = 0;
+  unsigned minute = 0;
+  double value = 0.0;
+
+  /** end of the reporting interval, same convention as SqlFile::timeSeries. RunPeriod and Annual rows have no month
+   *  and day, none is returned for them; SqlFile::timeSeries places them at the end of the environment period. */
+  boost::optional<DateTime> dateTime() const;
+};
+
+/** SqlFileTimeSeriesStatistics reduces streamed rows of one timeseries to sum, minimum, maximum with the time of the
+ *  peak, and monthly sums, in constant memory. */
+class UTILITIES_API SqlFileTimeSeriesStatistics
+{
+ public:
+  SqlFileTimeSeriesStatistics();
+
+  void add(const SqlFileTimeSeriesRow& row);
+
+  unsigned count() const;
+
+  double sum() const;
+
+  boost::optional<double> mean() const;
+
+  boost::optional<double> minimum() const;
+
+  boost::optional<double> maximum() const;
+
+  /// time of the first occurrence of the maximum
+  boost::optional<DateTime> peakDateTime() const;
+
+  /// sum of the values reported in each month, index 0 is January
+  const std::vector<double>& monthlySums() const;
+
+ private:
+  unsigned m_count;
+  double m_sum;
+  double m_minimum;
+  SqlFileTimeSeriesRow m_peak;
+  std::vector<double> m_monthlySums;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILETIMESERIESSTREAM_HPP
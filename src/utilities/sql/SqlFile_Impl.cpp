@@ -30,6 +30,7 @@
 #include "SqlFile_Impl.hpp"
 #include "SqlFileTimeSeriesQuery.hpp"
 #include "PreparedStatement.hpp"
+#include "SqlFileColumnar.hpp"
 #include "OpenStudio.hxx"
 
 #include "../time/Calendar.hpp"
@@ -39,6 +40,11 @@
 
 #include <sqlite3.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -55,8 +61,143 @@ namespace detail {
     return std::string(reinterpret_cast<const char*>(column));
   }
 
-  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-    : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true), m_hasIlluminanceMapYear(true) {
+  void TabularReportTable::addValue(const std::string& rowName, const std::string& columnName, const std::string& units, double value,
+                                    const std::string& text) {
+    m_values.emplace(std::make_tuple(rowName, columnName, units), Value{value, text});
+  }
+
+  boost::optional<double> TabularReportTable::getDouble(const std::string& rowName, const std::string& columnName, const std::string& units) const {
+    auto it = m_values.find(std::make_tuple(rowName, columnName, units));
+    if (it == m_values.end()) {
+      return boost::none;
+    }
+    return it->second.value;
+  }
+
+  boost::optional<std::string> TabularReportTable::getString(const std::string& rowName, const std::string& columnName,
+                                                             const std::string& units) const {
+    auto it = m_values.find(std::make_tuple(rowName, columnName, units));
+    if (it == m_values.end()) {
+      return boost::none;
+    }
+    return it->second.text;
+  }
+
+  bool TabularReportTable::empty() const {
+    return m_values.empty();
+  }
+
+  size_t TabularReportTable::size() const {
+    return m_values.size();
+  }
+
+  ReportDataTimeSeriesBuilder::ReportDataTimeSeriesBuilder(const std::string& reportingFrequency, const std::string& energyPlusVersion,
+                                                           std::function<DateTime()> firstDateTime, std::function<DateTime()> lastDateTime)
+    : m_reportingFrequency(ReportingFrequency::RunPeriod),
+      m_isEnergyPlus83(false),
+      m_firstDateTime(std::move(firstDateTime)),
+      m_lastDateTime(std::move(lastDateTime)),
+      m_isIntervalTimeSeries(false),
+      m_cumulativeSeconds(0) {
+    try {
+      m_reportingFrequency = ReportingFrequency(reportingFrequency);
+      m_isIntervalTimeSeries = (m_reportingFrequency == ReportingFrequency::Timestep) || (m_reportingFrequency == ReportingFrequency::Hourly)
+                               || (m_reportingFrequency == ReportingFrequency::Daily);
+
+    } catch (const std::exception&) {
+    }
+
+    VersionString version(energyPlusVersion);
+    m_isEnergyPlus83 = (version.major() == 8) && (version.minor() == 3);
+
+    m_secondsFromFirstReport.reserve(8760);
+    m_values.reserve(8760);
+  }
+
+  void ReportDataTimeSeriesBuilder::addRow(double value, boost::optional<unsigned> year, unsigned month, unsigned day, unsigned interval) {
+    m_values.push_back(value);
+
+    // In cases where you report the same meter key for eg at Daily and at Timestep frequency
+    // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
+    // And since we can compute this easily, might as well do it
+    unsigned intervalMinutes;
+    if (m_reportingFrequency == ReportingFrequency::Hourly) {
+      intervalMinutes = 60;
+    } else if (m_reportingFrequency == ReportingFrequency::Daily) {
+      intervalMinutes = 24 * 60;
+    } else if (m_reportingFrequency == ReportingFrequency::Monthly) {
+      intervalMinutes = day * 24 * 60;
+    } else {
+      // If Detailed, Timestep, RunPeriod, or Annual: it varies
+      intervalMinutes = interval;
+
+      if (m_reportingFrequency == ReportingFrequency::Annual) {
+        // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
+        // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
+        // cf https://github.com/NREL/EnergyPlus/issues/7939
+        if (intervalMinutes == 0) {
+          intervalMinutes = 365 * 24 * 60;
+        } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
+          // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
+          LOG_FREE(Debug, "openstudio.energyplus.SqlFile",
+                   "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
+        }
+      }
+    }
+
+    if (m_isEnergyPlus83) {
+      // workaround for bug in E+ 8.3, issue #1692
+      if (m_reportingFrequency == ReportingFrequency::RunPeriod) {
+        Time deltaT = m_lastDateTime() - m_firstDateTime();
+        intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
+      }
+    }
+
+    if (!m_firstReportDateTime) {
+      if ((month == 0) || (day == 0)) {
+        // gets called for RunPeriod reports
+        m_firstReportDateTime = m_lastDateTime();
+      } else {
+        // DLM: get standard time zone?
+        if (intervalMinutes >= 24 * 60) {
+          // Daily or Monthly
+          OS_ASSERT(intervalMinutes % (24 * 60) == 0);
+          m_firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
+                                       : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
+        } else {
+          m_firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
+                                       : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
+        }
+      }
+    }
+
+    // Use the new way to create the time series with nonzero first entry
+    m_cumulativeSeconds += 60 * intervalMinutes;
+    m_secondsFromFirstReport.push_back(m_cumulativeSeconds);
+
+    // check if this interval is same as the others
+    if (m_isIntervalTimeSeries && !m_reportingIntervalMinutes) {
+      m_reportingIntervalMinutes = intervalMinutes;
+    } else if (m_reportingIntervalMinutes && (m_reportingIntervalMinutes.get() != intervalMinutes)) {
+      m_isIntervalTimeSeries = false;
+      m_reportingIntervalMinutes.reset();
+    }
+  }
+
+  boost::optional<TimeSeries> ReportDataTimeSeriesBuilder::timeSeries(const std::string& units) const {
+    if (!m_firstReportDateTime || m_secondsFromFirstReport.empty()) {
+      return boost::none;
+    }
+    openstudio::Vector values = createVector(m_values);
+    if (m_isIntervalTimeSeries) {
+      openstudio::Time intervalTime(0, 0, *m_reportingIntervalMinutes, 0);
+      return openstudio::TimeSeries(*m_firstReportDateTime, intervalTime, values, units);
+    }
+    return openstudio::TimeSeries(*m_firstReportDateTime, m_secondsFromFirstReport, values, units);
+  }
+
+  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes, const bool readOnly)
+    : m_path(path), m_connectionOpen(false), m_readOnly(readOnly), m_supportedVersion(false), m_hasYear(true), m_hasIlluminanceMapYear(true) {
     if (openstudio::filesystem::exists(m_path)) {
       m_path = openstudio::filesystem::canonical(m_path);
     }
@@ -72,6 +213,7 @@ namespace detail {
     }
     m_sqliteFilename = toString(m_path.make_preferred().native());
     std::string fileName = m_sqliteFilename;
+    m_readOnly = false;
     m_hasYear = true;
     m_hasIlluminanceMapYear = true;
 
@@ -237,6 +379,10 @@ namespace detail {
   }
 
   void SqlFile_Impl::removeIndexes() {
+    if (m_connectionOpen && m_readOnly) {
+      LOG(Warn, "Cannot remove indexes from '" << toString(m_path) << "', it is opened read-only");
+      return;
+    }
     if (m_connectionOpen) {
       try {
         execAndThrowOnError("DROP INDEX IF EXISTS rddMTR;");
@@ -277,6 +423,15 @@ namespace detail {
   }
 
   void SqlFile_Impl::createIndexes() {
+    if (m_connectionOpen && m_readOnly) {
+      // the file is never written to in read-only mode, only report the indexes that are missing
+      for (const char* index : {"rddMTR", "redRD", "rdTI", "rdDI", "dmhdHRI", "dmhrMNI"}) {
+        if (execAndReturnFirstInt("SELECT COUNT(*) FROM sqlite_master WHERE type='index' AND name=?", index) != 1) {
+          LOG(Info, "Index " << index << " does not exist in '" << toString(m_path) << "' and cannot be created read-only, queries may be slower");
+        }
+      }
+      return;
+    }
     if (m_connectionOpen) {
       try {
         execAndThrowOnError("CREATE INDEX IF NOT EXISTS rddMTR ON ReportDataDictionary (IsMeter);");
@@ -321,6 +476,7 @@ namespace detail {
   }
 
   void SqlFile_Impl::execAndThrowOnError(const std::string& t_stmt) {
+    clearTabularReportTables();
     char* err = nullptr;
     if (sqlite3_exec(m_db, t_stmt.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
       std::string errstr;
@@ -413,6 +569,10 @@ namespace detail {
     return m_connectionOpen;
   }
 
+  bool SqlFile_Impl::readOnly() const {
+    return m_readOnly;
+  }
+
   int SqlFile_Impl::getNextIndex(const std::string& t_tableName, const std::string& t_columnName) {
     // Interestingly, you CANNOT bind any database identifier (such as the table name / column name) but only litteral values...
     // boost::optional<int> maxindex = execAndReturnFirstInt("SELECT MAX( ? ) FROM ?", t_columnName, t_tableName);
@@ -431,6 +591,12 @@ namespace detail {
   }
 
   bool SqlFile_Impl::close() {
+    clearTabularReportTables();
+    // cached statements must be finalized before the connection can be closed
+    {
+      std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+      m_preparedStatements.clear();
+    }
     if (m_connectionOpen) {
       sqlite3_close(m_db);
       m_connectionOpen = false;
@@ -454,11 +620,20 @@ namespace detail {
     m_sqliteFilename = toString(m_path.make_preferred().native());
     std::string fileName = m_sqliteFilename;
 
-    int code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+    int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE;
+    if (m_readOnly) {
+      // no write locks are taken so other processes and threads can open their own connection to the same file
+      flags = SQLITE_OPEN_READONLY;
+    }
+    int code = sqlite3_open_v2(fileName.c_str(), &m_db, flags, nullptr);
 
     m_connectionOpen = (code == 0);
     if (m_connectionOpen) {  // create index on dictionaryIndex for large table reportvariabledata
       if (!isValidConnection()) {
+        {
+          std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+          m_preparedStatements.clear();
+        }
         sqlite3_close(m_db);
         m_connectionOpen = false;
         throw openstudio::Exception("OpenStudio is not compatible with this file.");
@@ -466,6 +641,11 @@ namespace detail {
       // set a 1 second timeout
       code = sqlite3_busy_timeout(m_db, 1000);
 
+      if (m_readOnly) {
+        // map up to 256 MB of the file and use a 64 MB page cache, results are only read so trade memory for fewer reads
+        sqlite3_exec(m_db, "PRAGMA query_only = ON; PRAGMA mmap_size = 268435456; PRAGMA cache_size = -65536;", nullptr, nullptr, nullptr);
+      }
+
       // set locking mode to exclusive
       //code = sqlite3_exec(m_db, "PRAGMA locking_mode=EXCLUSIVE", NULL, NULL, NULL);
 
@@ -647,84 +827,123 @@ namespace detail {
                                           const openstudio::ReportingFrequency& t_reportingFrequency,
                                           const boost::optional<std::string>& t_scheduleName, const std::string& t_variableUnits,
                                           const openstudio::TimeSeries& t_timeSeries) {
-    int datadicindex = getNextIndex("reportdatadictionary", "ReportDataDictionaryIndex");
+    insertTimeSeriesData(std::vector<SqlFileTimeSeriesData>{SqlFileTimeSeriesData(t_variableType, t_indexGroup, t_timestepType, t_keyValue,
+                                                                                  t_variableName, t_reportingFrequency, t_scheduleName,
+                                                                                  t_variableUnits, t_timeSeries)});
+  }
 
-    std::stringstream insertReportDataDictionary;
-    insertReportDataDictionary << "insert into reportdatadictionary (ReportDataDictionaryIndex, IsMeter, Type, IndexGroup, TimestepType, KeyValue, "
-                                  "Name, ReportingFrequency, ScheduleName, Units) values ("
-                               << datadicindex << ", "
-                               << "'0',"
-                               << "'" << t_variableType << "', "
-                               << "'" << t_indexGroup << "', "
-                               << "'" << t_timestepType << "', "
-                               << "'" << t_keyValue << "', "
-                               << "'" << t_variableName << "', "
-                               << "'" << t_reportingFrequency.valueName() << "', ";
-
-    if (t_scheduleName) {
-      insertReportDataDictionary << "'" << *t_scheduleName << "', ";
-    } else {
-      insertReportDataDictionary << "null, ";
+  void SqlFile_Impl::insertTimeSeriesData(const std::vector<SqlFileTimeSeriesData>& t_timeSeriesData) {
+    if (t_timeSeriesData.empty()) {
+      return;
     }
 
-    insertReportDataDictionary << "'" << t_variableUnits << "');";
+    // look up time indices once instead of with a subquery per row, keeping the first match like the subquery did
+    std::map<std::tuple<int, int, int, int, int>, int> timeIndices;
+    {
+      std::string query = hasYear() ? "SELECT TimeIndex, Year, Month, Day, Hour, Minute FROM Time ORDER BY TimeIndex"
+                                    : "SELECT TimeIndex, 0, Month, Day, Hour, Minute FROM Time ORDER BY TimeIndex";
+      sqlite3_stmt* sqlStmtPtr;
+      sqlite3_prepare_v2(m_db, query.c_str(), -1, &sqlStmtPtr, nullptr);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        timeIndices.emplace(std::make_tuple(sqlite3_column_int(sqlStmtPtr, 1), sqlite3_column_int(sqlStmtPtr, 2), sqlite3_column_int(sqlStmtPtr, 3),
+                                            sqlite3_column_int(sqlStmtPtr, 4), sqlite3_column_int(sqlStmtPtr, 5)),
+                            sqlite3_column_int(sqlStmtPtr, 0));
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
 
-    execAndThrowOnError(insertReportDataDictionary.str());
+    // indexes are allocated up front rather than with a MAX() query per row
+    int datadicindex = getNextIndex("reportdatadictionary", "ReportDataDictionaryIndex");
+    int reportdataindex = getNextIndex("reportdata", "ReportDataIndex");
 
-    std::vector<double> values = toStandardVector(t_timeSeries.values());
-    std::vector<double> days = toStandardVector(t_timeSeries.daysFromFirstReport());
+    execAndThrowOnError("BEGIN");
+    try {
+      PreparedStatement insertReportDataDictionary(
+        "insert into reportdatadictionary (ReportDataDictionaryIndex, IsMeter, Type, IndexGroup, TimestepType, KeyValue, Name, ReportingFrequency, "
+        "ScheduleName, Units) values (?, 0, ?, ?, ?, ?, ?, ?, ?, ?);",
+        m_db);
+
+      // 100 rows of 4 values stays below the default limit of 999 bound parameters
+      constexpr size_t rowsPerInsert = 100;
+      std::string multiRowInsert = "insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values (?, ?, ?, ?)";
+      for (size_t i = 1; i < rowsPerInsert; ++i) {
+        multiRowInsert += ", (?, ?, ?, ?)";
+      }
+      PreparedStatement insertReportDataRows(multiRowInsert + ";", m_db);
+      PreparedStatement insertReportDataRow(
+        "insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values (?, ?, ?, ?);", m_db);
+
+      for (const SqlFileTimeSeriesData& data : t_timeSeriesData) {
+        int b = 0;
+        insertReportDataDictionary.bind(++b, datadicindex);
+        insertReportDataDictionary.bind(++b, data.variableType);
+        insertReportDataDictionary.bind(++b, data.indexGroup);
+        insertReportDataDictionary.bind(++b, data.timestepType);
+        insertReportDataDictionary.bind(++b, data.keyValue);
+        insertReportDataDictionary.bind(++b, data.variableName);
+        insertReportDataDictionary.bind(++b, data.reportingFrequency.valueName());
+        if (data.scheduleName) {
+          insertReportDataDictionary.bind(++b, *data.scheduleName);
+        } else {
+          insertReportDataDictionary.bindNull(++b);
+        }
+        insertReportDataDictionary.bind(++b, data.variableUnits);
+        insertReportDataDictionary.execAndThrowOnError();
 
-    openstudio::DateTime firstdate = t_timeSeries.firstReportDateTime();
+        std::vector<double> values = toStandardVector(data.timeSeries.values());
+        std::vector<double> days = toStandardVector(data.timeSeries.daysFromFirstReport());
 
-    std::shared_ptr<PreparedStatement> stmt;
-    if (hasYear()) {
-      // we'll let stmt1 have the transaction
-      stmt =
-        std::make_shared<PreparedStatement>("insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values ( ?, "
-                                            "(select TimeIndex from time where Year=? and Month=? and Day=? and Hour=? and Minute=? limit 1), ?, ?);",
-                                            m_db, true);
-    } else {
-      stmt = std::make_shared<PreparedStatement>("insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values ( ?, "
-                                                 "(select TimeIndex from time where Month=? and Day=? and Hour=? and Minute=? limit 1), ?, ?);",
-                                                 m_db, true);
-    }
+        openstudio::DateTime firstdate = data.timeSeries.firstReportDateTime();
 
-    for (size_t i = 0; i < values.size(); ++i) {
-      openstudio::DateTime dt = firstdate + openstudio::Time(days[i]);
-      double value = values[i];
+        // full groups of rowsPerInsert rows use the multi row insert, the remainder goes one row at a time
+        const size_t numMultiRow = values.size() - values.size() % rowsPerInsert;
+        for (size_t i = 0; i < values.size(); ++i) {
+          openstudio::DateTime dt = firstdate + openstudio::Time(days[i]);
 
-      if (dt.time().seconds() == 59) {
-        // rounding error, let's help
-        dt += openstudio::Time(0, 0, 0, 1);
-      }
+          if (dt.time().seconds() == 59) {
+            // rounding error, let's help
+            dt += openstudio::Time(0, 0, 0, 1);
+          }
 
-      if (dt.time().seconds() == 1) {
-        // rounding error, let's help
-        dt -= openstudio::Time(0, 0, 0, 1);
-      }
+          if (dt.time().seconds() == 1) {
+            // rounding error, let's help
+            dt -= openstudio::Time(0, 0, 0, 1);
+          }
 
-      int year = dt.date().year();
-      int month = dt.date().monthOfYear().value();
-      int day = dt.date().dayOfMonth();
-      int hour = dt.time().hours();
-      int minute = dt.time().minutes();
+          int year = hasYear() ? dt.date().year() : 0;
+          int month = dt.date().monthOfYear().value();
+          int day = dt.date().dayOfMonth();
+          int hour = dt.time().hours();
+          int minute = dt.time().minutes();
 
-      ++hour;  // energyplus says time goes from 1-24 not from 0-23
+          ++hour;  // energyplus says time goes from 1-24 not from 0-23
 
-      int reportdataindex = getNextIndex("reportdata", "ReportDataIndex");
-      int b = 0;
-      stmt->bind(++b, reportdataindex);
-      if (hasYear()) {
-        stmt->bind(++b, year);
+          const bool multiRow = (i < numMultiRow);
+          PreparedStatement& stmt = multiRow ? insertReportDataRows : insertReportDataRow;
+          int p = multiRow ? 4 * static_cast<int>(i % rowsPerInsert) : 0;
+
+          stmt.bind(++p, reportdataindex++);
+          auto timeIndex = timeIndices.find(std::make_tuple(year, month, day, hour, minute));
+          if (timeIndex != timeIndices.end()) {
+            stmt.bind(++p, timeIndex->second);
+          } else {
+            stmt.bindNull(++p);
+          }
+          stmt.bind(++p, datadicindex);
+          stmt.bind(++p, values[i]);
+
+          if (!multiRow || (i % rowsPerInsert == rowsPerInsert - 1)) {
+            stmt.execAndThrowOnError();
+          }
+        }
+
+        ++datadicindex;
       }
-      stmt->bind(++b, month);
-      stmt->bind(++b, day);
-      stmt->bind(++b, hour);
-      stmt->bind(++b, minute);
-      stmt->bind(++b, datadicindex);
-      stmt->bind(++b, value);
 
-      stmt->execAndThrowOnError();
+      execAndThrowOnError("COMMIT");
+    } catch (...) {
+      sqlite3_exec(m_db, "ROLLBACK", nullptr, nullptr, nullptr);
+      throw;
     }
   }
 
@@ -772,6 +991,61 @@ namespace detail {
     return retval;
   }
 
+  std::shared_ptr<const TabularReportTable> SqlFile_Impl::tabularReportTable(const std::string& reportName,
+                                                                            const std::string& reportForString,
+                                                                            const std::string& tableName) const {
+    auto key = std::make_tuple(reportName, reportForString, tableName);
+    std::lock_guard<std::mutex> lock(m_tabularReportTablesMutex);
+    auto it = m_tabularReportTables.find(key);
+    if (it != m_tabularReportTables.end()) {
+      return it->second;
+    }
+
+    auto result = std::make_shared<TabularReportTable>();
+    if (m_db) {
+      sqlite3_stmt* sqlStmtPtr;
+
+      std::string stmt = "SELECT RowName, ColumnName, Units, Value FROM TabularDataWithStrings "
+                         "WHERE ReportName = ? AND ReportForString = ? AND TableName = ?";
+
+      sqlite3_prepare_v2(m_db, stmt.c_str(), -1, &sqlStmtPtr, nullptr);
+      sqlite3_bind_text(sqlStmtPtr, 1, reportName.c_str(), -1, SQLITE_TRANSIENT);
+      sqlite3_bind_text(sqlStmtPtr, 2, reportForString.c_str(), -1, SQLITE_TRANSIENT);
+      sqlite3_bind_text(sqlStmtPtr, 3, tableName.c_str(), -1, SQLITE_TRANSIENT);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        // NULL never matches an equality test so these rows could not be found by a single value query either
+        if ((sqlite3_column_type(sqlStmtPtr, 0) == SQLITE_NULL) || (sqlite3_column_type(sqlStmtPtr, 1) == SQLITE_NULL)
+            || (sqlite3_column_type(sqlStmtPtr, 2) == SQLITE_NULL)) {
+          continue;
+        }
+        std::string rowName = columnText(sqlite3_column_text(sqlStmtPtr, 0));
+        std::string columnName = columnText(sqlite3_column_text(sqlStmtPtr, 1));
+        std::string units = columnText(sqlite3_column_text(sqlStmtPtr, 2));
+        double value = sqlite3_column_double(sqlStmtPtr, 3);
+        std::string text;
+        if (sqlite3_column_type(sqlStmtPtr, 3) != SQLITE_NULL) {
+          text = columnText(sqlite3_column_text(sqlStmtPtr, 3));
+        }
+        result->addValue(rowName, columnName, units, value, text);
+      }
+
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    m_tabularReportTables[key] = result;
+    return result;
+  }
+
+  boost::optional<double> SqlFile_Impl::endUsesValue(const std::string& columnName, const std::string& rowName, const std::string& units) const {
+    return tabularReportTable("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses")
+      ->getDouble(rowName, columnName, units);
+  }
+
+  void SqlFile_Impl::clearTabularReportTables() const {
+    std::lock_guard<std::mutex> lock(m_tabularReportTablesMutex);
+    m_tabularReportTables.clear();
+  }
+
   void SqlFile_Impl::retrieveDataDictionary() {
     std::string table, name, keyValue, units, rf;
 
@@ -1225,15 +1499,15 @@ namespace detail {
   boost::optional<EndUses> SqlFile_Impl::endUses() const {
     EndUses result;
 
+    // read the whole table at once rather than querying each fuel type and category
+    std::shared_ptr<const TabularReportTable> table =
+      tabularReportTable("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses");
+
     for (EndUseFuelType fuelType : result.fuelTypes()) {
       std::string units = result.getUnitsForFuelType(fuelType);
       for (EndUseCategoryType category : result.categories()) {
 
-        std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
-                            "(ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='"
-                            + fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-        boost::optional<double> value = execAndReturnFirstDouble(query);
+        boost::optional<double> value = table->getDouble(category.valueDescription(), fuelType.valueDescription(), units);
         OS_ASSERT(value);
 
         if (*value != 0.0) {
@@ -1246,542 +1520,362 @@ namespace detail {
   }
 
   OptionalDouble SqlFile_Impl::electricityHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::electricityTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return endUsesValue("Electricity", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Interior Equipment", "GJ");
   }
   OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return endUsesValue("Natural Gas", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heating') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Cooling') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Fans') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Pumps') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Humidification') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Generators') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::otherFuelTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return endUsesValue("Additional Fuel", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Interior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Exterior Lighting", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return endUsesValue("District Cooling", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heating') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Heating", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Cooling') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Cooling", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Lights') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Interior Lights", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Exterior Lights", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Interior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Exterior Equipment", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Fans') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Fans", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Pumps') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Pumps", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Heat Rejection", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Humidification') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Humidification", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Heat Recovery", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Water Systems') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Water Systems", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Refrigeration') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Refrigeration", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Generators') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Generators", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::districtHeatingTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Total End Uses') and (Units = 'GJ')");
+    return endUsesValue("District Heating", "Total End Uses", "GJ");
   }
 
   OptionalDouble SqlFile_Impl::waterHeating() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+    return endUsesValue("Water", "Heating", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterCooling() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+    return endUsesValue("Water", "Cooling", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterInteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+    return endUsesValue("Water", "Interior Lighting", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterExteriorLighting() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+    return endUsesValue("Water", "Exterior Lighting", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterInteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+    return endUsesValue("Water", "Interior Equipment", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterExteriorEquipment() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+    return endUsesValue("Water", "Exterior Equipment", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterFans() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+    return endUsesValue("Water", "Fans", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterPumps() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+    return endUsesValue("Water", "Pumps", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHeatRejection() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+    return endUsesValue("Water", "Heat Rejection", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHumidification() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+    return endUsesValue("Water", "Humidification", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterHeatRecovery() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+    return endUsesValue("Water", "Heat Recovery", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterWaterSystems() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+    return endUsesValue("Water", "Water Systems", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterRefrigeration() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+    return endUsesValue("Water", "Refrigeration", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterGenerators() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+    return endUsesValue("Water", "Generators", "m3");
   }
 
   OptionalDouble SqlFile_Impl::waterTotalEndUses() const {
-    return execAndReturnFirstDouble(
-      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
-      "Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+    return endUsesValue("Water", "Total End Uses", "m3");
   }
 
   OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const {
@@ -2051,7 +2145,7 @@ namespace detail {
     }
   }
 
-  openstudio::DateTime SqlFile_Impl::firstDateTime(bool includeHourAndMinute, int envPeriodIndex) {
+  openstudio::DateTime SqlFile_Impl::firstDateTime(bool includeHourAndMinute, int envPeriodIndex) const {
     // default until added to eplusout.sql from energy plus
     boost::optional<unsigned> year;
     unsigned month = 1, day = 1, hour = 1, minute = 0;
@@ -2098,7 +2192,7 @@ namespace detail {
     return openstudio::DateTime(date, time);
   }
 
-  openstudio::DateTime SqlFile_Impl::lastDateTime(bool includeHourAndMinute, int envPeriodIndex) {
+  openstudio::DateTime SqlFile_Impl::lastDateTime(bool includeHourAndMinute, int envPeriodIndex) const {
     // default until added to eplusout.sql from energy plus
     boost::optional<unsigned> year;
     unsigned month = 1, day = 1, hour = 1, minute = 0;
@@ -2147,29 +2241,12 @@ namespace detail {
 
   openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary) {
     openstudio::OptionalTimeSeries ts;
-    std::string units = dataDictionary.units;
-
-    boost::optional<openstudio::DateTime> firstReportDateTime;
-    std::vector<long> stdSecondsFromFirstReport;
-    stdSecondsFromFirstReport.reserve(8760);
-
-    std::vector<double> stdValues;
-    stdValues.reserve(8760);
-    boost::optional<unsigned> reportingIntervalMinutes;
-
-    ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
-    bool isIntervalTimeSeries = false;
-    try {
-      reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
-      isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) || (reportingFrequency == ReportingFrequency::Hourly)
-                             || (reportingFrequency == ReportingFrequency::Daily);
-
-    } catch (const std::exception&) {
-    }
 
     if (m_db) {
-      std::string energyPlusVersion = this->energyPlusVersion();
-      VersionString version(energyPlusVersion);
+      const int envPeriodIndex = dataDictionary.envPeriodIndex;
+      ReportDataTimeSeriesBuilder builder(
+        dataDictionary.reportingFrequency, this->energyPlusVersion(), [this, envPeriodIndex]() { return firstDateTime(false, envPeriodIndex); },
+        [this, envPeriodIndex]() { return lastDateTime(false, envPeriodIndex); });
 
       std::stringstream s;
       // v8.9.0 added the 'Year' field
@@ -2204,12 +2281,9 @@ namespace detail {
       s2 << code;
       LOG(Debug, s2.str());
 
-      long cumulativeSeconds = 0;
-
       while (code == SQLITE_ROW) {
         int b = 0;
         double value = sqlite3_column_double(sqlStmtPtr, b++);
-        stdValues.push_back(value);
 
         boost::optional<unsigned> year;
         if (hasYear()) {
@@ -2223,75 +2297,9 @@ namespace detail {
 
         unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
         unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
+        unsigned interval = sqlite3_column_int(sqlStmtPtr, b++);
 
-        // In cases where you report the same meter key for eg at Daily and at Timestep frequency
-        // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
-        // And since we can compute this easily, might as well do it
-        unsigned intervalMinutes;
-        if (reportingFrequency == ReportingFrequency::Hourly) {
-          intervalMinutes = 60;
-        } else if (reportingFrequency == ReportingFrequency::Daily) {
-          intervalMinutes = 24 * 60;
-        } else if (reportingFrequency == ReportingFrequency::Monthly) {
-          intervalMinutes = day * 24 * 60;
-        } else {
-          // If Detailed, Timestep, RunPeriod, or Annual: it varies
-          intervalMinutes = sqlite3_column_int(sqlStmtPtr, b);  // Notice I'm not incrementing the counter here on purpose
-
-          if (reportingFrequency == ReportingFrequency::Annual) {
-            // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
-            // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
-            // cf https://github.com/NREL/EnergyPlus/issues/7939
-            if (intervalMinutes == 0) {
-              intervalMinutes = 365 * 24 * 60;
-            } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
-              // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
-              LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
-            }
-          }
-        }
-        // Don't forget to increment the counter anyway, no matter whether we did call sqlite3_column_int or not
-        ++b;
-
-        if ((version.major() == 8) && (version.minor() == 3)) {
-          // workaround for bug in E+ 8.3, issue #1692
-          if (reportingFrequency == ReportingFrequency::RunPeriod) {
-            DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-            DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
-            Time deltaT = lastDateTime - firstDateTime;
-            intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
-          }
-        }
-
-        if (!firstReportDateTime) {
-          if ((month == 0) || (day == 0)) {
-            // gets called for RunPeriod reports
-            firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
-          } else {
-            // DLM: get standard time zone?
-            if (intervalMinutes >= 24 * 60) {
-              // Daily or Monthly
-              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
-            } else {
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
-            }
-          }
-        }
-
-        // Use the new way to create the time series with nonzero first entry
-        cumulativeSeconds += 60 * intervalMinutes;
-        stdSecondsFromFirstReport.push_back(cumulativeSeconds);
-
-        // check if this interval is same as the others
-        if (isIntervalTimeSeries && !reportingIntervalMinutes) {
-          reportingIntervalMinutes = intervalMinutes;
-        } else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)) {
-          isIntervalTimeSeries = false;
-          reportingIntervalMinutes.reset();
-        }
+        builder.addRow(value, year, month, day, interval);
 
         // step to next row
         code = sqlite3_step(sqlStmtPtr);
@@ -2300,16 +2308,7 @@ namespace detail {
       // must finalize to prevent memory leaks
       sqlite3_finalize(sqlStmtPtr);
 
-      if (firstReportDateTime && !stdSecondsFromFirstReport.empty()) {
-        if (isIntervalTimeSeries) {
-          openstudio::Time intervalTime(0, 0, *reportingIntervalMinutes, 0);
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
-        } else {
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
-        }
-      }
+      ts = builder.timeSeries(dataDictionary.units);
     }
 
     return ts;
@@ -2378,6 +2377,182 @@ namespace detail {
     return dateTimes;
   }
 
+  std::vector<const DataDictionaryItem*> SqlFile_Impl::findDataDictionaryItems(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                                               const std::vector<std::string>& timeSeriesNames,
+                                                                               const std::vector<std::string>& keyValues) const {
+    if (timeSeriesNames.size() != keyValues.size()) {
+      throw std::runtime_error("Number of time series names does not match number of key values");
+    }
+
+    std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+    const auto& index = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+
+    std::vector<const DataDictionaryItem*> result(timeSeriesNames.size(), nullptr);
+    for (size_t j = 0; j < timeSeriesNames.size(); ++j) {
+      auto it = index.find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesNames[j], keyValues[j]));
+      if (it == index.end()) {
+        it = index.find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesNames[j], boost::to_upper_copy(keyValues[j])));
+      }
+      if (it == index.end()) {
+        LOG(Warn, "Tuple: " << queryEnvPeriod << ", " << reportingFrequency << ", " << timeSeriesNames[j] << ", " << keyValues[j]
+                            << " not found in data dictionary.");
+      } else {
+        result[j] = &(*it);
+      }
+    }
+    return result;
+  }
+
+  bool SqlFile_Impl::streamTimeSeries(const std::vector<const DataDictionaryItem*>& items,
+                                      const std::function<bool(const std::vector<SqlFileTimeSeriesRow>&)>& callback, unsigned batchSize) const {
+    // the same timeseries may be requested more than once
+    std::map<int, std::vector<unsigned>> columnsByDictionaryIndex;
+    boost::optional<int> envPeriodIndex;
+    for (size_t j = 0; j < items.size(); ++j) {
+      if (items[j]) {
+        columnsByDictionaryIndex[items[j]->recordIndex].push_back(static_cast<unsigned>(j));
+        envPeriodIndex = items[j]->envPeriodIndex;
+      }
+    }
+
+    if (!m_db || !envPeriodIndex) {
+      return false;
+    }
+
+    // meters and variables share the ReportData table and its dictionary index
+    std::stringstream s;
+    s << "SELECT rd.TimeIndex, rd.ReportDataDictionaryIndex, rd.Value, ";
+    if (hasYear()) {
+      s << "Time.Year, ";
+    }
+    s << "Time.Month, Time.Day, Time.Hour, Time.Minute FROM ReportData rd INNER JOIN Time ON Time.TimeIndex = rd.TimeIndex";
+    s << " WHERE Time.EnvironmentPeriodIndex = " << *envPeriodIndex;
+    s << " AND rd.ReportDataDictionaryIndex IN (";
+    for (auto it = columnsByDictionaryIndex.begin(); it != columnsByDictionaryIndex.end(); ++it) {
+      if (it != columnsByDictionaryIndex.begin()) {
+        s << ", ";
+      }
+      s << it->first;
+    }
+    s << ") ORDER BY rd.TimeIndex";
+
+    sqlite3_stmt* sqlStmtPtr = nullptr;
+    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    // finalize on every path, the callback may throw and the statement would otherwise keep its read lock
+    std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> statementGuard(sqlStmtPtr, &sqlite3_finalize);
+    if (code != SQLITE_OK) {
+      throw std::runtime_error("Error creating prepared statement: " + s.str() + " with error code " + std::to_string(code));
+    }
+
+    batchSize = std::max(batchSize, 1u);
+    std::vector<SqlFileTimeSeriesRow> batch;
+    batch.reserve(batchSize);
+
+    bool keepGoing = true;
+    SqlFileTimeSeriesRow row;
+    code = sqlite3_step(sqlStmtPtr);
+    while (keepGoing && (code == SQLITE_ROW)) {
+      int b = 0;
+      row.timeIndex = sqlite3_column_int(sqlStmtPtr, b++);
+      int dictionaryIndex = sqlite3_column_int(sqlStmtPtr, b++);
+      row.value = sqlite3_column_double(sqlStmtPtr, b++);
+      row.year = hasYear() ? sqlite3_column_int(sqlStmtPtr, b++) : 0;
+      row.month = sqlite3_column_int(sqlStmtPtr, b++);
+      row.day = sqlite3_column_int(sqlStmtPtr, b++);
+      row.hour = sqlite3_column_int(sqlStmtPtr, b++);
+      row.minute = sqlite3_column_int(sqlStmtPtr, b++);
+
+      for (unsigned j : columnsByDictionaryIndex[dictionaryIndex]) {
+        row.column = j;
+        batch.push_back(row);
+      }
+
+      if (batch.size() >= batchSize) {
+        keepGoing = callback(batch);
+        batch.clear();
+      }
+
+      code = sqlite3_step(sqlStmtPtr);
+    }
+    if (keepGoing && !batch.empty()) {
+      callback(batch);
+    }
+
+    return true;
+  }
+
+  bool SqlFile_Impl::streamTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency,
+                                      const std::vector<std::string>& timeSeriesNames, const std::vector<std::string>& keyValues,
+                                      const std::function<bool(const std::vector<SqlFileTimeSeriesRow>&)>& callback, unsigned batchSize) const {
+    return streamTimeSeries(findDataDictionaryItems(envPeriod, reportingFrequency, timeSeriesNames, keyValues), callback, batchSize);
+  }
+
+  void SqlFile_Impl::exportColumnar(const openstudio::path& path, bool compress) const {
+    exportColumnarReportData(m_db, hasYear(), energyPlusVersion(), path, compress);
+  }
+
+  std::vector<SqlFileTimeSeriesStatistics> SqlFile_Impl::timeSeriesStatistics(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                                              const std::vector<std::string>& timeSeriesNames,
+                                                                              const std::vector<std::string>& keyValues) const {
+    std::vector<SqlFileTimeSeriesStatistics> result(timeSeriesNames.size());
+    streamTimeSeries(envPeriod, reportingFrequency, timeSeriesNames, keyValues, [&result](const std::vector<SqlFileTimeSeriesRow>& rows) {
+      for (const auto& row : rows) {
+        result[row.column].add(row);
+      }
+      return true;
+    });
+    return result;
+  }
+
+  SqlFileTimeSeriesMatrix SqlFile_Impl::timeSeriesMatrix(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                         const std::vector<std::string>& timeSeriesNames,
+                                                         const std::vector<std::string>& keyValues) const {
+    std::vector<const DataDictionaryItem*> items = findDataDictionaryItems(envPeriod, reportingFrequency, timeSeriesNames, keyValues);
+
+    const size_t numColumns = items.size();
+    std::vector<std::string> units(numColumns);
+    for (size_t j = 0; j < numColumns; ++j) {
+      if (items[j]) {
+        units[j] = items[j]->units;
+      }
+    }
+
+    boost::optional<int> envPeriodIndex;
+    for (const DataDictionaryItem* item : items) {
+      if (item) {
+        envPeriodIndex = item->envPeriodIndex;
+      }
+    }
+
+    std::vector<DateTime> dateTimes;
+    // filled row by row as rows are ordered by time, transposed at the end
+    std::vector<double> rowMajor;
+    boost::optional<int> currentTimeIndex;
+    streamTimeSeries(items, [&](const std::vector<SqlFileTimeSeriesRow>& rows) {
+      for (const auto& row : rows) {
+        if (!currentTimeIndex || (*currentTimeIndex != row.timeIndex)) {
+          currentTimeIndex = row.timeIndex;
+          // RunPeriod and Annual reports have no date, placed at the end of the environment period as in timeSeries
+          boost::optional<DateTime> dateTime = row.dateTime();
+          dateTimes.push_back(dateTime ? *dateTime : lastDateTime(false, *envPeriodIndex));
+          rowMajor.resize(rowMajor.size() + numColumns, std::numeric_limits<double>::quiet_NaN());
+        }
+        rowMajor[(dateTimes.size() - 1) * numColumns + row.column] = row.value;
+      }
+      return true;
+    });
+
+    const size_t numRows = dateTimes.size();
+    std::vector<double> values(numRows * numColumns);
+    for (size_t i = 0; i < numRows; ++i) {
+      for (size_t j = 0; j < numColumns; ++j) {
+        values[j * numRows + i] = rowMajor[i * numColumns + j];
+      }
+    }
+
+    return SqlFileTimeSeriesMatrix(dateTimes, timeSeriesNames, keyValues, units, values);
+  }
+
   openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency,
                                                           const std::string& timeSeriesName, const std::string& keyValue) {
     //std::string queryEnvPeriod = envPeriod;
@@ -3354,6 +3529,105 @@ namespace detail {
     return illuminance;
   }
 
+  SqlFileIlluminanceMapData SqlFile_Impl::illuminanceMapData(const std::string& name, double threshold) const {
+    boost::optional<int> mapIndex = illuminanceMapIndex(name);
+    if (!mapIndex) {
+      LOG(Error, "Unknown illuminance map '" << name << "'");
+      return SqlFileIlluminanceMapData();
+    }
+    return illuminanceMapData(*mapIndex, threshold);
+  }
+
+  SqlFileIlluminanceMapData SqlFile_Impl::illuminanceMapData(const int& mapIndex, double threshold) const {
+    std::vector<std::pair<int, DateTime>> reportIndicesDates = illuminanceMapHourlyReportIndicesDates(mapIndex);
+    if (reportIndicesDates.empty()) {
+      LOG(Warn, "No hourly reports for illuminance map " << mapIndex);
+      return SqlFileIlluminanceMapData();
+    }
+    std::sort(reportIndicesDates.begin(), reportIndicesDates.end(),
+              [](const std::pair<int, DateTime>& lhs, const std::pair<int, DateTime>& rhs) { return lhs.first < rhs.first; });
+
+    // the grid is the same for every hour of a map, take it from the first report, sorted in ascending order
+    Vector xv = illuminanceMapX(reportIndicesDates.front().first);
+    Vector yv = illuminanceMapY(reportIndicesDates.front().first);
+    std::vector<double> xs(xv.begin(), xv.end());
+    std::vector<double> ys(yv.begin(), yv.end());
+
+    const size_t numPoints = xs.size() * ys.size();
+    std::vector<double> values(reportIndicesDates.size() * numPoints, std::numeric_limits<double>::quiet_NaN());
+
+    // per point metrics are accumulated while reading, mean holds the sum until all rows are read
+    std::vector<unsigned> hoursAboveThreshold(numPoints, 0);
+    std::vector<double> meanIlluminance(numPoints, 0.0);
+    std::vector<unsigned> counts(numPoints, 0);
+
+    std::string query = "SELECT d.HourlyReportIndex, d.X, d.Y, d.Illuminance FROM DaylightMapHourlyData d "
+                        "INNER JOIN DaylightMapHourlyReports r ON d.HourlyReportIndex = r.HourlyReportIndex "
+                        "WHERE r.MapNumber = ? ORDER BY d.HourlyReportIndex";
+
+    sqlite3_stmt* sqlStmtPtr;
+    sqlite3_prepare_v2(m_db, query.c_str(), -1, &sqlStmtPtr, nullptr);
+    sqlite3_bind_int(sqlStmtPtr, 1, mapIndex);
+
+    size_t hour = 0;
+    unsigned unmatched = 0;
+    while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+      int hourlyReportIndex = sqlite3_column_int(sqlStmtPtr, 0);
+      double xVal = sqlite3_column_double(sqlStmtPtr, 1);
+      double yVal = sqlite3_column_double(sqlStmtPtr, 2);
+      double illuminance = sqlite3_column_double(sqlStmtPtr, 3);
+
+      // rows and reports are both ordered by HourlyReportIndex
+      while ((hour < reportIndicesDates.size()) && (reportIndicesDates[hour].first < hourlyReportIndex)) {
+        ++hour;
+      }
+      auto xIt = std::lower_bound(xs.begin(), xs.end(), xVal);
+      auto yIt = std::lower_bound(ys.begin(), ys.end(), yVal);
+      if ((hour == reportIndicesDates.size()) || (reportIndicesDates[hour].first != hourlyReportIndex) || (xIt == xs.end()) || (*xIt != xVal)
+          || (yIt == ys.end()) || (*yIt != yVal)) {
+        ++unmatched;
+        continue;
+      }
+
+      size_t point = (yIt - ys.begin()) * xs.size() + (xIt - xs.begin());
+      double& value = values[hour * numPoints + point];
+      if (std::isnan(value)) {
+        ++counts[point];
+      } else {
+        // a point reported twice in the same hour keeps the last value, take the first one out of the metrics
+        meanIlluminance[point] -= value;
+        if (value >= threshold) {
+          --hoursAboveThreshold[point];
+        }
+      }
+      value = illuminance;
+      meanIlluminance[point] += illuminance;
+      if (illuminance >= threshold) {
+        ++hoursAboveThreshold[point];
+      }
+    }
+
+    /// must finalize to prevent memory leaks
+    sqlite3_finalize(sqlStmtPtr);
+
+    if (unmatched > 0) {
+      LOG(Warn, unmatched << " illuminance map values for map " << mapIndex << " do not fall on the grid of its first hourly report");
+    }
+
+    std::vector<DateTime> dateTimes;
+    dateTimes.reserve(reportIndicesDates.size());
+    for (const auto& reportIndexDate : reportIndicesDates) {
+      dateTimes.push_back(reportIndexDate.second);
+    }
+
+    for (size_t p = 0; p < numPoints; ++p) {
+      meanIlluminance[p] = (counts[p] > 0) ? meanIlluminance[p] / counts[p] : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return SqlFileIlluminanceMapData(std::move(dateTimes), std::move(xs), std::move(ys), std::move(values), threshold,
+                                     std::move(hoursAboveThreshold), std::move(meanIlluminance));
+  }
+
   // find the illuminance map index by name
   boost::optional<int> SqlFile_Impl::illuminanceMapIndex(const std::string& name) const {
     // TODO: haven't figured out how to bind properly to the LIKE statement, tried
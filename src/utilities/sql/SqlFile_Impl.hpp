@@ -35,15 +35,25 @@
 #include "SummaryData.hpp"
 #include "SqlFileEnums.hpp"
 #include "SqlFileDataDictionary.hpp"
+#include "SqlFileTimeSeriesMatrix.hpp"
+#include "SqlFileTimeSeriesStream.hpp"
+#include "SqlFileTimeSeriesData.hpp"
+#include "SqlFileIlluminanceMapData.hpp"
 #include "PreparedStatement.hpp"
 #include "../data/DataEnums.hpp"
+#include "../data/TimeSeries.hpp"
 #include "../data/EndUses.hpp"
 #include "../core/Optional.hpp"
 #include "../data/Matrix.hpp"
 
 #include <boost/optional.hpp>
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <vector>
 
 struct sqlite3;
@@ -59,6 +69,67 @@ class Calendar;
 // private namespace
 namespace detail {
 
+  /// Writes the data dictionary, time table and one time index and one value column per variable of an EnergyPlus
+  /// sql database to path, used by SqlFile::exportColumnar. Throws on failure.
+  void exportColumnarReportData(sqlite3* db, bool hasYear, const std::string& energyPlusVersion, const openstudio::path& path, bool compress);
+
+  /// One table of a tabular report (ReportName, ReportForString, TableName) read from TabularDataWithStrings in a single query,
+  /// values are indexed by RowName, ColumnName and Units
+  class UTILITIES_API TabularReportTable
+  {
+   public:
+    /// adds a value, if a value already exists for this row, column and units the first one is kept to match SELECT ... LIMIT 1
+    void addValue(const std::string& rowName, const std::string& columnName, const std::string& units, double value, const std::string& text);
+
+    /// value converted to a double by sqlite, same as execAndReturnFirstDouble on the Value column
+    boost::optional<double> getDouble(const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+    /// value as stored in the table
+    boost::optional<std::string> getString(const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+    bool empty() const;
+
+    size_t size() const;
+
+   private:
+    struct Value
+    {
+      double value;
+      std::string text;
+    };
+
+    std::map<std::tuple<std::string, std::string, std::string>, Value> m_values;
+  };
+
+  /// Builds the TimeSeries of one variable from its rows in one environment period, in time order. Shared by SqlFile::timeSeries
+  /// and SqlFileColumnarReader::timeSeries so both agree on report dates and intervals
+  class UTILITIES_API ReportDataTimeSeriesBuilder
+  {
+   public:
+    /// firstDateTime and lastDateTime return the first and last dates of the environment period, they are only called when needed
+    ReportDataTimeSeriesBuilder(const std::string& reportingFrequency, const std::string& energyPlusVersion,
+                                std::function<DateTime()> firstDateTime, std::function<DateTime()> lastDateTime);
+
+    /// interval is the Interval column of the Time table, month and day are 0 for RunPeriod and Annual rows
+    void addRow(double value, boost::optional<unsigned> year, unsigned month, unsigned day, unsigned interval);
+
+    /// interval series if all intervals are equal for Timestep, Hourly and Daily, detailed series otherwise
+    boost::optional<TimeSeries> timeSeries(const std::string& units) const;
+
+   private:
+    ReportingFrequency m_reportingFrequency;
+    bool m_isEnergyPlus83;
+    std::function<DateTime()> m_firstDateTime;
+    std::function<DateTime()> m_lastDateTime;
+
+    boost::optional<DateTime> m_firstReportDateTime;
+    bool m_isIntervalTimeSeries;
+    boost::optional<unsigned> m_reportingIntervalMinutes;
+    long m_cumulativeSeconds;
+    std::vector<long> m_secondsFromFirstReport;
+    std::vector<double> m_values;
+  };
+
   class UTILITIES_API SqlFile_Impl
   {
    public:
@@ -66,7 +137,9 @@ namespace detail {
     /// or if file is not valid
     /// createIndexes will create useful indexes when opening an sqlite file but for faster opening
     /// pass in false if those indexes are not needed
-    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true);
+    /// readOnly opens the file without ever writing to it, so several connections can read it concurrently,
+    /// indexes are then only used if they already exist
+    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true, const bool readOnly = false);
 
     /// createIndexes will create useful indexes when creating an sqlite file but for faster creation
     /// pass in false if those indexes are not needed
@@ -85,6 +158,9 @@ namespace detail {
     /// returns whether or not connection is open
     bool connectionOpen() const;
 
+    /// returns whether the file was opened read-only
+    bool readOnly() const;
+
     /// get the path
     openstudio::path path() const;
 
@@ -657,6 +733,24 @@ namespace detail {
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
     std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+    /** Returns the timeseries for each pair of timeSeriesNames and keyValues in one matrix, fetched with a single query
+     *  ordered by time. Columns follow the requested order, a timeseries that is not found gives a column of NaN.
+     *  Throws if timeSeriesNames and keyValues differ in size. */
+    SqlFileTimeSeriesMatrix timeSeriesMatrix(const std::string& envPeriod, const std::string& reportingFrequency,
+                                             const std::vector<std::string>& timeSeriesNames, const std::vector<std::string>& keyValues) const;
+
+    /** Reads the values of each pair of timeSeriesNames and keyValues ordered by time and passes them to callback in batches
+     *  of at most batchSize rows, without building any TimeSeries. Reading stops early if callback returns false. Returns
+     *  false if none of the timeseries were found. Throws if timeSeriesNames and keyValues differ in size. */
+    bool streamTimeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames,
+                          const std::vector<std::string>& keyValues, const std::function<bool(const std::vector<SqlFileTimeSeriesRow>&)>& callback,
+                          unsigned batchSize = 8760) const;
+
+    /// Sum, minimum, peak and monthly sums of each pair of timeSeriesNames and keyValues, computed by streamTimeSeries
+    std::vector<SqlFileTimeSeriesStatistics> timeSeriesStatistics(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                                  const std::vector<std::string>& timeSeriesNames,
+                                                                  const std::vector<std::string>& keyValues) const;
+
     // returns an optional pair of date times for begin and end of daylight savings time
     boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime>> daylightSavingsPeriod() const;
 
@@ -739,13 +833,21 @@ namespace detail {
     /// value(i,j) is the illuminance at x(i), y(j) - returns x, y and illuminance
     void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const;
 
+    /// every hourly report of the illuminance map read with one query, with hours at or above threshold and mean of each point
+    SqlFileIlluminanceMapData illuminanceMapData(const std::string& name, double threshold) const;
+    SqlFileIlluminanceMapData illuminanceMapData(const int& mapIndex, double threshold) const;
+
     // execute a statement and return the first (if any) value as a double.
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<double> execAndReturnFirstDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstDouble();
+        std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
+        auto result = stmt.execAndReturnFirstDouble();
+        // release the read lock held by a partially stepped statement
+        stmt.reset();
+        return result;
       }
       return boost::none;
     }
@@ -755,8 +857,12 @@ namespace detail {
     template <typename... Args>
     boost::optional<int> execAndReturnFirstInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstInt();
+        std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
+        auto result = stmt.execAndReturnFirstInt();
+        // release the read lock held by a partially stepped statement
+        stmt.reset();
+        return result;
       }
       return boost::none;
     }
@@ -766,8 +872,12 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::string> execAndReturnFirstString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstString();
+        std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
+        auto result = stmt.execAndReturnFirstString();
+        // release the read lock held by a partially stepped statement
+        stmt.reset();
+        return result;
       }
       return boost::none;
     }
@@ -777,8 +887,12 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<double>> execAndReturnVectorOfDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfDouble();
+        std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
+        auto result = stmt.execAndReturnVectorOfDouble();
+        // release the read lock held by a partially stepped statement
+        stmt.reset();
+        return result;
       }
       return boost::none;
     }
@@ -788,8 +902,12 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<int>> execAndReturnVectorOfInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfInt();
+        std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
+        auto result = stmt.execAndReturnVectorOfInt();
+        // release the read lock held by a partially stepped statement
+        stmt.reset();
+        return result;
       }
       return boost::none;
     }
@@ -799,8 +917,12 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<std::string>> execAndReturnVectorOfString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfString();
+        std::lock_guard<std::mutex> lock(m_preparedStatementsMutex);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
+        auto result = stmt.execAndReturnVectorOfString();
+        // release the read lock held by a partially stepped statement
+        stmt.reset();
+        return result;
       }
       return boost::none;
     }
@@ -813,15 +935,25 @@ namespace detail {
       constexpr auto SQLITE_ERROR = 1;
       auto code = SQLITE_ERROR;
       if (m_db) {
+        // statement may modify tabular data
+        clearTabularReportTables();
         PreparedStatement stmt(statement, m_db, false, args...);
         code = stmt.execute();
       }
       return code;
     }
 
+    /// Writes all report data to a columnar file readable by SqlFileColumnarReader, throws on failure
+    void exportColumnar(const openstudio::path& path, bool compress = true) const;
+
     /// Returns the summary data for each install location and fuel type found in report variables
     std::vector<openstudio::SummaryData> getSummaryData() const;
 
+    /// Loads all rows of a tabular report table in one query, the result is cached until the file is closed or modified.
+    /// Safe to call from several threads, a table returned stays valid even if the cache is cleared
+    std::shared_ptr<const TabularReportTable> tabularReportTable(const std::string& reportName, const std::string& reportForString,
+                                                                 const std::string& tableName) const;
+
     // Insert a new report variable record into the database
     // This does not support meter data
     void insertTimeSeriesData(const std::string& t_variableType, const std::string& t_indexGroup, const std::string& t_timestepType,
@@ -829,6 +961,10 @@ namespace detail {
                               const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
                               const std::string& t_variableUnits, const openstudio::TimeSeries& t_timeSeries);
 
+    // Insert many report variable records in a single transaction, indexes are allocated once and rows are written
+    // with multi row inserts. This does not support meter data
+    void insertTimeSeriesData(const std::vector<SqlFileTimeSeriesData>& t_timeSeriesData);
+
     int insertZone(const std::string& t_name, double t_relNorth, double t_originX, double t_originY, double t_originZ, double t_centroidX,
                    double t_centroidY, double t_centroidZ, int t_ofType, double t_multiplier, double t_listMultiplier, double t_minimumX,
                    double t_maximumX, double t_minimumY, double t_maximumY, double t_minimumZ, double t_maximumZ, double t_ceilingHeight,
@@ -861,6 +997,7 @@ namespace detail {
     template <typename... Args>
     void execAndThrowOnError(const std::string& bindingStatement, Args&&... args) {
       if (m_db) {
+        clearTabularReportTables();
         PreparedStatement stmt(bindingStatement, m_db, false, args...);
         stmt.execAndThrowOnError();
       }
@@ -876,10 +1013,10 @@ namespace detail {
     boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
     // return first date in time table used for start date of run period variables
-    openstudio::DateTime firstDateTime(bool includeHourAndMinute, int envPeriodIndex);
+    openstudio::DateTime firstDateTime(bool includeHourAndMinute, int envPeriodIndex) const;
 
     // return last date in time table used for end date of run period variables
-    openstudio::DateTime lastDateTime(bool includeHourAndMinute, int envPeriodIndex);
+    openstudio::DateTime lastDateTime(bool includeHourAndMinute, int envPeriodIndex) const;
 
     // DLM: timeSeriesInterval seems pretty useless, can we remove it?
     boost::optional<Time> timeSeriesInterval(const DataDictionaryItem& dataDictionary);
@@ -890,8 +1027,34 @@ namespace detail {
 
     void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
+    // value from the 'End Uses' table of the AnnualBuildingUtilityPerformanceSummary for the Entire Facility
+    boost::optional<double> endUsesValue(const std::string& columnName, const std::string& rowName, const std::string& units) const;
+
+    void clearTabularReportTables() const;
+
+    // data dictionary item for each pair of timeSeriesNames and keyValues, nullptr if not found
+    std::vector<const DataDictionaryItem*> findDataDictionaryItems(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                                   const std::vector<std::string>& timeSeriesNames,
+                                                                   const std::vector<std::string>& keyValues) const;
+
+    bool streamTimeSeries(const std::vector<const DataDictionaryItem*>& items,
+                          const std::function<bool(const std::vector<SqlFileTimeSeriesRow>&)>& callback, unsigned batchSize = 8760) const;
+
+    // return the cached prepared statement for this text with the bind arguments bound, the statement must be reset after use
+    // and m_preparedStatementsMutex must be held until then
+    template <typename... Args>
+    PreparedStatement& cachedStatement(const std::string& statement, Args&&... args) const {
+      PreparedStatement& stmt = m_preparedStatements.get(statement, m_db);
+      if (!stmt.bindAll(args...)) {
+        stmt.reset();
+        throw std::runtime_error("Error bindings args with statement: " + statement);
+      }
+      return stmt;
+    }
+
     openstudio::path m_path;
     bool m_connectionOpen;
+    bool m_readOnly;
     DataDictionaryTable m_dataDictionary;
     sqlite3* m_db;
     std::string m_sqliteFilename;
@@ -902,6 +1065,15 @@ namespace detail {
 
     bool m_hasIlluminanceMapYear;
 
+    // filled by const accessors, guarded by m_tabularReportTablesMutex
+    mutable std::map<std::tuple<std::string, std::string, std::string>, std::shared_ptr<const TabularReportTable>> m_tabularReportTables;
+    mutable std::mutex m_tabularReportTablesMutex;
+
+    // read queries reuse prepared statements, must be cleared before m_db is closed. Const queries share the cache and
+    // step its statements, m_preparedStatementsMutex is held from binding until reset
+    mutable PreparedStatementCache m_preparedStatements;
+    mutable std::mutex m_preparedStatementsMutex;
+
     REGISTER_LOGGER("openstudio.energyplus.SqlFile");
   };
 
@@ -37,6 +37,9 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -246,3 +249,60 @@ TEST_F(IlluminanceMapFixture, IlluminanceMap_Year) {
   EXPECT_TRUE(firstDateTime.date().baseYear());
   EXPECT_EQ(2017, firstDateTime.date().baseYear().get());
 }
+
+TEST_F(IlluminanceMapFixture, IlluminanceMapData) {
+  const std::string& mapName = "CLASSROOM ILLUMINANCE MAP";
+
+  SqlFileIlluminanceMapData data = sqlFile.illuminanceMapData(mapName, 500.0);
+  ASSERT_EQ(4760u, data.numHours());
+  ASSERT_EQ(9u, data.numX());
+  ASSERT_EQ(9u, data.numY());
+  EXPECT_EQ(4760u * 81u, data.values().size());
+  EXPECT_EQ(500.0, data.threshold());
+
+  // matches the per hour accessors
+  std::vector<std::pair<int, DateTime>> reportIndicesDates = sqlFile.illuminanceMapHourlyReportIndicesDates(mapName);
+  ASSERT_EQ(data.numHours(), reportIndicesDates.size());
+  for (unsigned h : {0u, 100u, 2000u, 4759u}) {
+    EXPECT_EQ(reportIndicesDates[h].second, data.dateTimes()[h]);
+    Matrix expected = sqlFile.illuminanceMap(reportIndicesDates[h].first);
+    Matrix actual = data.illuminanceMap(h);
+    ASSERT_EQ(expected.size1(), actual.size1());
+    ASSERT_EQ(expected.size2(), actual.size2());
+    for (unsigned i = 0; i < expected.size1(); ++i) {
+      for (unsigned j = 0; j < expected.size2(); ++j) {
+        EXPECT_EQ(expected(i, j), actual(i, j));
+        EXPECT_EQ(expected(i, j), data.value(h, i, j));
+      }
+    }
+  }
+
+  // metrics over the whole year
+  double maxValue = *std::max_element(data.values().begin(), data.values().end());
+  EXPECT_EQ(3701, maxValue);
+  ASSERT_EQ(81u, data.hoursAboveThreshold().size());
+  ASSERT_EQ(81u, data.meanIlluminance().size());
+  unsigned expectedHours = 0;
+  double expectedSum = 0.0;
+  for (unsigned h = 0; h < data.numHours(); ++h) {
+    double v = data.value(h, 4, 4);
+    expectedSum += v;
+    if (v >= 500.0) {
+      ++expectedHours;
+    }
+  }
+  EXPECT_EQ(expectedHours, data.hoursAboveThreshold()[4 * 9 + 4]);
+  EXPECT_NEAR(expectedSum / data.numHours(), data.meanIlluminance()[4 * 9 + 4], 1.0e-9);
+
+  // metrics accumulated while reading match the ones computed from the values
+  SqlFileIlluminanceMapData recomputed(data.dateTimes(), data.x(), data.y(), data.values(), 500.0);
+  EXPECT_EQ(recomputed.hoursAboveThreshold(), data.hoursAboveThreshold());
+  for (unsigned p = 0; p < 81u; ++p) {
+    EXPECT_NEAR(recomputed.meanIlluminance()[p], data.meanIlluminance()[p], 1.0e-9);
+  }
+
+  EXPECT_THROW(data.value(4760, 0, 0), std::out_of_range);
+  EXPECT_THROW(data.illuminanceMap(4760), std::out_of_range);
+
+  EXPECT_EQ(0u, sqlFile.illuminanceMapData("NOT A MAP").numHours());
+}
@@ -0,0 +1,224 @@
+#include <benchmark/benchmark.h>
+
+#include "../SqlFile.hpp"
+#include "../PreparedStatement.hpp"
+#include "../SqlFileColumnar.hpp"
+#include "../../data/TimeSeries.hpp"
+#include "../../core/Path.hpp"
+
+#include <resources.hxx>
+
+#include <sqlite3.h>
+
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+
+static openstudio::path benchmarkSqlPath() {
+  return resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql");
+}
+
+static const std::string summaryQuery = R"(SELECT Value FROM TabularDataWithStrings
+                                             WHERE ReportName=?
+                                             AND ReportForString='Entire Facility'
+                                             AND TableName=?
+                                             AND RowName=?
+                                             AND ColumnName=?
+                                             AND Units=?)";
+
+// Reference for the previous behavior, where every query prepared and finalized its own statement
+static void BM_SummaryQueryPrepareEachTime(benchmark::State& state) {
+  sqlite3* db = nullptr;
+  sqlite3_open_v2(toString(benchmarkSqlPath()).c_str(), &db, SQLITE_OPEN_READONLY, nullptr);
+
+  for (auto _ : state) {
+    PreparedStatement stmt(summaryQuery, db, false, "AnnualBuildingUtilityPerformanceSummary", "End Uses", "Heating", "Electricity", "GJ");
+    boost::optional<double> value = stmt.execAndReturnFirstDouble();
+    benchmark::DoNotOptimize(value);
+  }
+
+  sqlite3_close(db);
+}
+
+static void BM_SummaryQueryCached(benchmark::State& state) {
+  SqlFile sqlFile(benchmarkSqlPath());
+
+  for (auto _ : state) {
+    boost::optional<double> value =
+      sqlFile.execAndReturnFirstDouble(summaryQuery, "AnnualBuildingUtilityPerformanceSummary", "End Uses", "Heating", "Electricity", "GJ");
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+static void BM_NetSiteEnergy(benchmark::State& state) {
+  SqlFile sqlFile(benchmarkSqlPath());
+
+  for (auto _ : state) {
+    boost::optional<double> value = sqlFile.netSiteEnergy();
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+static void BM_SummaryQueries(benchmark::State& state) {
+  SqlFile sqlFile(benchmarkSqlPath());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sqlFile.hoursSimulated());
+    benchmark::DoNotOptimize(sqlFile.totalSiteEnergy());
+    benchmark::DoNotOptimize(sqlFile.totalSourceEnergy());
+    benchmark::DoNotOptimize(sqlFile.electricityTotalEndUses());
+    benchmark::DoNotOptimize(sqlFile.naturalGasTotalEndUses());
+  }
+}
+
+// all hourly name/key value pairs of the first environment period
+static void hourlyVariables(SqlFile& sqlFile, std::string& envPeriod, std::vector<std::string>& names, std::vector<std::string>& keyValues) {
+  envPeriod = sqlFile.availableEnvPeriods().front();
+  for (const std::string& name : sqlFile.availableVariableNames(envPeriod, "Hourly")) {
+    for (const std::string& keyValue : sqlFile.availableKeyValues(envPeriod, "Hourly", name)) {
+      names.push_back(name);
+      keyValues.push_back(keyValue);
+    }
+  }
+}
+
+static void BM_TimeSeriesOneByOne(benchmark::State& state) {
+  std::string envPeriod;
+  std::vector<std::string> names;
+  std::vector<std::string> keyValues;
+  {
+    SqlFile sqlFile(benchmarkSqlPath());
+    hourlyVariables(sqlFile, envPeriod, names, keyValues);
+  }
+
+  for (auto _ : state) {
+    // timeSeries caches results in the data dictionary, so use a fresh file each time
+    state.PauseTiming();
+    SqlFile sqlFile(benchmarkSqlPath());
+    state.ResumeTiming();
+    for (size_t j = 0; j < names.size(); ++j) {
+      boost::optional<TimeSeries> ts = sqlFile.timeSeries(envPeriod, "Hourly", names[j], keyValues[j]);
+      benchmark::DoNotOptimize(ts);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+static void BM_TimeSeriesMatrix(benchmark::State& state) {
+  SqlFile sqlFile(benchmarkSqlPath());
+  std::string envPeriod;
+  std::vector<std::string> names;
+  std::vector<std::string> keyValues;
+  hourlyVariables(sqlFile, envPeriod, names, keyValues);
+
+  for (auto _ : state) {
+    SqlFileTimeSeriesMatrix matrix = sqlFile.timeSeriesMatrix(envPeriod, "Hourly", names, keyValues);
+    benchmark::DoNotOptimize(matrix.values().data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+static void BM_PeakOneByOne(benchmark::State& state) {
+  std::string envPeriod;
+  std::vector<std::string> names;
+  std::vector<std::string> keyValues;
+  {
+    SqlFile sqlFile(benchmarkSqlPath());
+    hourlyVariables(sqlFile, envPeriod, names, keyValues);
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    SqlFile sqlFile(benchmarkSqlPath());
+    state.ResumeTiming();
+    for (size_t j = 0; j < names.size(); ++j) {
+      boost::optional<TimeSeries> ts = sqlFile.timeSeries(envPeriod, "Hourly", names[j], keyValues[j]);
+      if (ts) {
+        benchmark::DoNotOptimize(maximum(ts->values()));
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+static void BM_PeakStatistics(benchmark::State& state) {
+  SqlFile sqlFile(benchmarkSqlPath());
+  std::string envPeriod;
+  std::vector<std::string> names;
+  std::vector<std::string> keyValues;
+  hourlyVariables(sqlFile, envPeriod, names, keyValues);
+
+  for (auto _ : state) {
+    std::vector<SqlFileTimeSeriesStatistics> statistics = sqlFile.timeSeriesStatistics(envPeriod, "Hourly", names, keyValues);
+    benchmark::DoNotOptimize(statistics.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+static void BM_ColumnarReload(benchmark::State& state) {
+  openstudio::path columnarPath = toPath("./SqlFile_Benchmark.oscol");
+  std::string envPeriod;
+  std::vector<std::string> names;
+  std::vector<std::string> keyValues;
+  {
+    SqlFile sqlFile(benchmarkSqlPath());
+    hourlyVariables(sqlFile, envPeriod, names, keyValues);
+    sqlFile.exportColumnar(columnarPath, state.range(0) != 0);
+  }
+
+  for (auto _ : state) {
+    SqlFileColumnarReader reader(columnarPath);
+    for (size_t j = 0; j < names.size(); ++j) {
+      boost::optional<TimeSeries> ts = reader.timeSeries(envPeriod, "Hourly", names[j], keyValues[j]);
+      benchmark::DoNotOptimize(ts);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+static openstudio::path illuminanceMapSqlPath() {
+  return resourcesPath() / toPath("energyplus/Daylighting_School/eplusout.sql");
+}
+
+// Reference for loading a year of maps through the per hour accessors
+static void BM_IlluminanceMapPerHour(benchmark::State& state) {
+  SqlFile sqlFile(illuminanceMapSqlPath(), true, true);
+  const std::string mapName = "CLASSROOM ILLUMINANCE MAP";
+
+  for (auto _ : state) {
+    std::vector<int> reportIndices = sqlFile.illuminanceMapHourlyReportIndices(mapName);
+    for (int reportIndex : reportIndices) {
+      Matrix map = sqlFile.illuminanceMap(reportIndex);
+      benchmark::DoNotOptimize(map.data().begin());
+    }
+  }
+}
+
+static void BM_IlluminanceMapData(benchmark::State& state) {
+  SqlFile sqlFile(illuminanceMapSqlPath(), true, true);
+  const std::string mapName = "CLASSROOM ILLUMINANCE MAP";
+
+  for (auto _ : state) {
+    SqlFileIlluminanceMapData data = sqlFile.illuminanceMapData(mapName);
+    benchmark::DoNotOptimize(data.values().data());
+  }
+}
+
+BENCHMARK(BM_SummaryQueryPrepareEachTime);
+BENCHMARK(BM_SummaryQueryCached);
+BENCHMARK(BM_NetSiteEnergy);
+BENCHMARK(BM_SummaryQueries);
+BENCHMARK(BM_TimeSeriesOneByOne)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TimeSeriesMatrix)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PeakOneByOne)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PeakStatistics)->Unit(benchmark::kMillisecond);
+// uncompressed and compressed
+BENCHMARK(BM_ColumnarReload)->Unit(benchmark::kMillisecond)->Arg(0)->Arg(1);
+BENCHMARK(BM_IlluminanceMapPerHour)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_IlluminanceMapData)->Unit(benchmark::kMillisecond);
@@ -30,10 +30,12 @@
 #include <gtest/gtest.h>
 
 #include "SqlFileFixture.hpp"
+#include "../SqlFileColumnar.hpp"
 
 #include "../../time/Date.hpp"
 #include "../../time/Calendar.hpp"
 #include "../../core/Optional.hpp"
+#include "../../core/Checksum.hpp"
 #include "../../data/DataEnums.hpp"
 #include "../../data/TimeSeries.hpp"
 #include "../../filetypes/EpwFile.hpp"
@@ -50,6 +52,9 @@
 #include <boost/regex.hpp>
 #include <resources.hxx>
 #include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <future>
 
 using namespace std;
 using namespace boost;
@@ -280,6 +285,55 @@ TEST_F(SqlFileFixture, CreateSqlFile) {
   }
 }
 
+TEST_F(SqlFileFixture, InsertTimeSeriesDataBatch) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileBatchTest.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+
+  // one series longer than a multi row insert and one shorter
+  std::vector<double> longValues;
+  for (int i = 0; i < 250; ++i) {
+    longValues.push_back(0.5 * i);
+  }
+  std::vector<double> shortValues{1.0, 2.0, 3.0};
+
+  TimeSeries longTimeSeries(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(longValues), "W");
+  TimeSeries shortTimeSeries(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(shortValues), "C");
+
+  {
+    openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                            openstudio::DateTime::now(), c);
+    ASSERT_TRUE(sql.connectionOpen());
+
+    std::vector<SqlFileTimeSeriesData> data;
+    data.emplace_back("Sum", "Zone", "Zone", "ZONE 1", "Zone Lights Electric Power", openstudio::ReportingFrequency::Hourly,
+                      boost::optional<std::string>(), "W", longTimeSeries);
+    data.emplace_back("Avg", "Zone", "Zone", "ZONE 1", "Zone Mean Air Temperature", openstudio::ReportingFrequency::Hourly,
+                      std::string("ALWAYS ON"), "C", shortTimeSeries);
+    sql.insertTimeSeriesData(data);
+  }
+
+  {
+    openstudio::SqlFile sql(outfile);
+    ASSERT_TRUE(sql.connectionOpen());
+    std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+    ASSERT_EQ(1u, envPeriods.size());
+    EXPECT_EQ(2u, sql.availableTimeSeries().size());
+
+    boost::optional<TimeSeries> ts = sql.timeSeries(envPeriods[0], "Hourly", "Zone Lights Electric Power", "ZONE 1");
+    ASSERT_TRUE(ts);
+    EXPECT_EQ(longValues, openstudio::toStandardVector(ts->values()));
+    EXPECT_EQ(openstudio::toStandardVector(longTimeSeries.daysFromFirstReport()), openstudio::toStandardVector(ts->daysFromFirstReport()));
+
+    ts = sql.timeSeries(envPeriods[0], "Hourly", "Zone Mean Air Temperature", "ZONE 1");
+    ASSERT_TRUE(ts);
+    EXPECT_EQ(shortValues, openstudio::toStandardVector(ts->values()));
+  }
+}
+
 TEST_F(SqlFileFixture, AnnualTotalCosts) {
 
   struct SqlResults
@@ -774,3 +828,355 @@ TEST_F(SqlFileFixture, EndUseFuelTypes_test) {
     //}
   }
 }
+
+TEST_F(SqlFileFixture, EndUses_TabularReportTable) {
+  auto query = [](const std::string& fuelType, const std::string& category, const std::string& units) {
+    return sqlFile.execAndReturnFirstDouble(
+      "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire "
+      "Facility') and (TableName = 'End Uses') and (ColumnName = ?) and (RowName = ?) and (Units = ?)",
+      fuelType, category, units);
+  };
+
+  // accessors read from the cached table, values must match single value queries
+  EXPECT_EQ(query("Electricity", "Heating", "GJ"), sqlFile.electricityHeating());
+  EXPECT_EQ(query("Electricity", "Interior Lighting", "GJ"), sqlFile.electricityInteriorLighting());
+  EXPECT_EQ(query("Electricity", "Total End Uses", "GJ"), sqlFile.electricityTotalEndUses());
+  EXPECT_EQ(query("Natural Gas", "Heating", "GJ"), sqlFile.naturalGasHeating());
+  EXPECT_EQ(query("Water", "Total End Uses", "m3"), sqlFile.waterTotalEndUses());
+
+  boost::optional<EndUses> endUses = sqlFile.endUses();
+  ASSERT_TRUE(endUses);
+  for (const EndUseFuelType& fuelType : endUses->fuelTypes()) {
+    std::string units = endUses->getUnitsForFuelType(fuelType);
+    for (const EndUseCategoryType& category : endUses->categories()) {
+      boost::optional<double> value = query(fuelType.valueDescription(), category.valueDescription(), units);
+      ASSERT_TRUE(value);
+      EXPECT_EQ(*value, endUses->getEndUse(fuelType, category)) << fuelType.valueDescription() << ", " << category.valueDescription();
+    }
+  }
+
+  // const accessors fill and clear the shared cache from several threads
+  boost::optional<double> heating = sqlFile.electricityHeating();
+  std::vector<std::future<void>> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.push_back(std::async(std::launch::async, [i, heating]() {
+      for (int j = 0; j < 50; ++j) {
+        if ((i == 0) && (j % 10 == 0)) {
+          sqlFile.execute("SELECT 1");
+        }
+        EXPECT_EQ(heating, sqlFile.electricityHeating());
+        EXPECT_TRUE(sqlFile.endUses());
+      }
+    }));
+  }
+  for (auto& reader : readers) {
+    reader.get();
+  }
+}
+
+TEST_F(SqlFileFixture, PreparedStatementCache) {
+  const std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
+                            "(ReportForString = 'Entire Facility') and (TableName = 'End Uses') and (ColumnName = ?) and (RowName = ?) and "
+                            "(Units = ?)";
+
+  boost::optional<double> heating = sqlFile.execAndReturnFirstDouble(query, "Electricity", "Heating", "GJ");
+  boost::optional<double> lighting = sqlFile.execAndReturnFirstDouble(query, "Electricity", "Interior Lighting", "GJ");
+  ASSERT_TRUE(heating);
+  ASSERT_TRUE(lighting);
+
+  // reusing the statement rebinds the arguments
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(heating, sqlFile.execAndReturnFirstDouble(query, "Electricity", "Heating", "GJ"));
+    EXPECT_EQ(lighting, sqlFile.execAndReturnFirstDouble(query, "Electricity", "Interior Lighting", "GJ"));
+  }
+  EXPECT_FALSE(sqlFile.execAndReturnFirstDouble(query, "Electricity", "Not An End Use", "GJ"));
+
+  // a wrong number of bind arguments throws but leaves the cached statement usable
+  EXPECT_THROW(sqlFile.execAndReturnFirstDouble(query, "Electricity", "Heating"), std::runtime_error);
+  EXPECT_EQ(heating, sqlFile.execAndReturnFirstDouble(query, "Electricity", "Heating", "GJ"));
+
+  // statements are finalized when the file is closed and prepared again after reopen
+  EXPECT_TRUE(sqlFile.reopen());
+  EXPECT_EQ(heating, sqlFile.execAndReturnFirstDouble(query, "Electricity", "Heating", "GJ"));
+  EXPECT_EQ(lighting, sqlFile.execAndReturnFirstDouble(query, "Electricity", "Interior Lighting", "GJ"));
+
+  // the same cached statement used from several threads, each gets the result of its own bind arguments
+  std::vector<std::future<void>> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.push_back(std::async(std::launch::async, [&query, heating, lighting]() {
+      for (int j = 0; j < 100; ++j) {
+        EXPECT_EQ(heating, sqlFile.execAndReturnFirstDouble(query, "Electricity", "Heating", "GJ"));
+        EXPECT_EQ(lighting, sqlFile.execAndReturnFirstDouble(query, "Electricity", "Interior Lighting", "GJ"));
+      }
+    }));
+  }
+  for (auto& reader : readers) {
+    reader.get();
+  }
+}
+
+TEST_F(SqlFileFixture, TimeSeriesMatrix) {
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  const std::string& envPeriod = availableEnvPeriods[0];
+
+  std::vector<std::string> names{"Electricity:Facility", "Site Outdoor Air Drybulb Temperature", "NotAVariable:Facility", "NaturalGas:Facility",
+                                 "Electricity:Facility"};
+  std::vector<std::string> keyValues{"", "Environment", "", "", ""};
+
+  SqlFileTimeSeriesMatrix matrix = sqlFile.timeSeriesMatrix(envPeriod, "Hourly", names, keyValues);
+  ASSERT_EQ(5u, matrix.numColumns());
+  EXPECT_EQ(names, matrix.variableNames());
+  EXPECT_EQ(keyValues, matrix.keyValues());
+  EXPECT_EQ(matrix.numRows() * matrix.numColumns(), matrix.values().size());
+  EXPECT_EQ("J", matrix.units()[0]);
+  EXPECT_EQ("", matrix.units()[2]);
+
+  // each column matches the single timeseries query
+  for (unsigned j : {0u, 1u, 3u}) {
+    boost::optional<TimeSeries> ts = sqlFile.timeSeries(envPeriod, "Hourly", names[j], keyValues[j]);
+    ASSERT_TRUE(ts);
+    openstudio::Vector values = ts->values();
+    ASSERT_EQ(values.size(), matrix.numRows()) << names[j];
+    EXPECT_EQ(ts->firstReportDateTime(), matrix.dateTimes().front());
+    std::vector<double> column = matrix.column(j);
+    for (unsigned i = 0; i < matrix.numRows(); ++i) {
+      EXPECT_EQ(values[i], column[i]);
+      EXPECT_EQ(column[i], matrix.value(i, j));
+    }
+  }
+
+  // missing timeseries give NaN, repeated ones are copied
+  for (unsigned i = 0; i < matrix.numRows(); ++i) {
+    EXPECT_TRUE(std::isnan(matrix.value(i, 2)));
+    EXPECT_EQ(matrix.value(i, 0), matrix.value(i, 4));
+  }
+
+  EXPECT_THROW(matrix.value(matrix.numRows(), 0), std::out_of_range);
+  EXPECT_THROW(sqlFile.timeSeriesMatrix(envPeriod, "Hourly", names, {""}), std::runtime_error);
+
+  // run period reports have no month and day, they are placed like the single timeseries query places them
+  std::vector<std::string> runPeriodNames{"Electricity:Facility", "NaturalGas:Facility"};
+  std::vector<std::string> runPeriodKeyValues{"", ""};
+  SqlFileTimeSeriesMatrix runPeriodMatrix = sqlFile.timeSeriesMatrix(envPeriod, "Run Period", runPeriodNames, runPeriodKeyValues);
+  ASSERT_EQ(1u, runPeriodMatrix.numRows());
+  for (unsigned j = 0; j < runPeriodNames.size(); ++j) {
+    boost::optional<TimeSeries> ts = sqlFile.timeSeries(envPeriod, "Run Period", runPeriodNames[j], runPeriodKeyValues[j]);
+    ASSERT_TRUE(ts);
+    ASSERT_EQ(1u, ts->values().size());
+    EXPECT_EQ(ts->firstReportDateTime(), runPeriodMatrix.dateTimes()[0]);
+    EXPECT_EQ(ts->values()[0], runPeriodMatrix.value(0, j));
+  }
+}
+
+TEST_F(SqlFileFixture, StreamTimeSeries) {
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  const std::string& envPeriod = availableEnvPeriods[0];
+
+  std::vector<std::string> names{"Electricity:Facility", "NotAVariable:Facility", "Site Outdoor Air Drybulb Temperature"};
+  std::vector<std::string> keyValues{"", "", "Environment"};
+
+  boost::optional<TimeSeries> electricity = sqlFile.timeSeries(envPeriod, "Hourly", names[0], keyValues[0]);
+  boost::optional<TimeSeries> temperature = sqlFile.timeSeries(envPeriod, "Hourly", names[2], keyValues[2]);
+  ASSERT_TRUE(electricity);
+  ASSERT_TRUE(temperature);
+
+  // small batches, rows come in time order with their column
+  std::vector<double> streamed;
+  unsigned numBatches = 0;
+  EXPECT_TRUE(sqlFile.streamTimeSeries(
+    envPeriod, "Hourly", names, keyValues,
+    [&](const std::vector<SqlFileTimeSeriesRow>& rows) {
+      EXPECT_LE(rows.size(), 100u);
+      ++numBatches;
+      for (const auto& row : rows) {
+        EXPECT_NE(1u, row.column);
+        if (row.column == 0) {
+          streamed.push_back(row.value);
+        }
+      }
+      return true;
+    },
+    100));
+  openstudio::Vector electricityValues = electricity->values();
+  ASSERT_EQ(electricityValues.size(), streamed.size());
+  for (unsigned i = 0; i < streamed.size(); ++i) {
+    EXPECT_EQ(electricityValues[i], streamed[i]);
+  }
+  EXPECT_GT(numBatches, 1u);
+
+  // returning false stops reading
+  numBatches = 0;
+  sqlFile.streamTimeSeries(envPeriod, "Hourly", names, keyValues,
+                           [&](const std::vector<SqlFileTimeSeriesRow>&) {
+                             ++numBatches;
+                             return false;
+                           },
+                           10);
+  EXPECT_EQ(1u, numBatches);
+
+  // an exception from the callback propagates and the statement is still finalized
+  EXPECT_THROW(sqlFile.streamTimeSeries(envPeriod, "Hourly", names, keyValues,
+                                        [](const std::vector<SqlFileTimeSeriesRow>&) -> bool { throw std::runtime_error("stop"); }, 10),
+               std::runtime_error);
+  numBatches = 0;
+  EXPECT_TRUE(sqlFile.streamTimeSeries(envPeriod, "Hourly", names, keyValues,
+                                       [&](const std::vector<SqlFileTimeSeriesRow>&) {
+                                         ++numBatches;
+                                         return false;
+                                       },
+                                       10));
+  EXPECT_EQ(1u, numBatches);
+
+  EXPECT_FALSE(sqlFile.streamTimeSeries(envPeriod, "Hourly", {"NotAVariable:Facility"}, {""},
+                                        [](const std::vector<SqlFileTimeSeriesRow>&) { return true; }));
+
+  std::vector<SqlFileTimeSeriesStatistics> statistics = sqlFile.timeSeriesStatistics(envPeriod, "Hourly", names, keyValues);
+  ASSERT_EQ(3u, statistics.size());
+  EXPECT_EQ(0u, statistics[1].count());
+  EXPECT_FALSE(statistics[1].maximum());
+  EXPECT_FALSE(statistics[1].peakDateTime());
+
+  for (unsigned j : {0u, 2u}) {
+    const TimeSeries& ts = (j == 0) ? *electricity : *temperature;
+    const SqlFileTimeSeriesStatistics& stats = statistics[j];
+    openstudio::Vector values = ts.values();
+    ASSERT_EQ(values.size(), stats.count());
+    EXPECT_NEAR(sum(values), stats.sum(), 1.0e-6 * std::abs(stats.sum()));
+    EXPECT_DOUBLE_EQ(minimum(values), *stats.minimum());
+    EXPECT_DOUBLE_EQ(maximum(values), *stats.maximum());
+
+    std::vector<DateTime> dateTimes = ts.dateTimes();
+    auto peak = std::max_element(values.begin(), values.end());
+    ASSERT_TRUE(stats.peakDateTime());
+    EXPECT_EQ(dateTimes[peak - values.begin()], *stats.peakDateTime());
+
+    double monthlyTotal = 0.0;
+    for (double monthlySum : stats.monthlySums()) {
+      monthlyTotal += monthlySum;
+    }
+    EXPECT_NEAR(stats.sum(), monthlyTotal, 1.0e-6 * std::abs(stats.sum()));
+  }
+
+  // RunPeriod rows have no month and day, no date is made up for them
+  unsigned numRunPeriodRows = 0;
+  EXPECT_TRUE(sqlFile.streamTimeSeries(envPeriod, "Run Period", {"Electricity:Facility"}, {""},
+                                       [&](const std::vector<SqlFileTimeSeriesRow>& rows) {
+                                         for (const auto& row : rows) {
+                                           ++numRunPeriodRows;
+                                           EXPECT_FALSE(row.dateTime());
+                                         }
+                                         return true;
+                                       }));
+  EXPECT_EQ(1u, numRunPeriodRows);
+  std::vector<SqlFileTimeSeriesStatistics> runPeriodStatistics =
+    sqlFile.timeSeriesStatistics(envPeriod, "Run Period", {"Electricity:Facility"}, {""});
+  ASSERT_EQ(1u, runPeriodStatistics.size());
+  EXPECT_EQ(1u, runPeriodStatistics[0].count());
+  EXPECT_FALSE(runPeriodStatistics[0].peakDateTime());
+}
+
+TEST_F(SqlFileFixture, ReadOnly) {
+  openstudio::path path = sqlFile.path();
+  std::string checksumBefore = openstudio::checksum(path);
+
+  boost::optional<double> netSiteEnergy = sqlFile.netSiteEnergy();
+  ASSERT_TRUE(netSiteEnergy);
+  EXPECT_FALSE(sqlFile.readOnly());
+
+  // several readers, each with its own connection, use the file at the same time
+  std::vector<std::future<boost::optional<double>>> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.push_back(std::async(std::launch::async, [path]() {
+      SqlFile readOnlySqlFile(path, true, true);
+      EXPECT_TRUE(readOnlySqlFile.connectionOpen());
+      EXPECT_TRUE(readOnlySqlFile.readOnly());
+      readOnlySqlFile.removeIndexes();
+      return readOnlySqlFile.netSiteEnergy();
+    }));
+  }
+  for (auto& reader : readers) {
+    boost::optional<double> value = reader.get();
+    ASSERT_TRUE(value);
+    EXPECT_EQ(*netSiteEnergy, *value);
+  }
+
+  // index creation and removal were skipped
+  EXPECT_EQ(checksumBefore, openstudio::checksum(path));
+}
+
+void compareColumnarTimeSeries(const boost::optional<TimeSeries>& expected, const boost::optional<TimeSeries>& ts) {
+  ASSERT_TRUE(expected);
+  ASSERT_TRUE(ts);
+  EXPECT_EQ(expected->units(), ts->units());
+  EXPECT_EQ(expected->firstReportDateTime(), ts->firstReportDateTime());
+  ASSERT_EQ(bool(expected->intervalLength()), bool(ts->intervalLength()));
+  if (expected->intervalLength()) {
+    EXPECT_EQ(*expected->intervalLength(), *ts->intervalLength());
+  }
+  EXPECT_EQ(expected->secondsFromFirstReport(), ts->secondsFromFirstReport());
+  openstudio::Vector expectedValues = expected->values();
+  openstudio::Vector values = ts->values();
+  ASSERT_EQ(expectedValues.size(), values.size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(expectedValues[i], values[i]);
+  }
+}
+
+TEST_F(SqlFileFixture, ExportColumnar) {
+  openstudio::path compressedPath = toPath("./SqlFile_ExportColumnar.oscol");
+  openstudio::path rawPath = toPath("./SqlFile_ExportColumnar_Raw.oscol");
+  ASSERT_TRUE(sqlFile.exportColumnar(compressedPath));
+  ASSERT_TRUE(sqlFile.exportColumnar(rawPath, false));
+  EXPECT_LT(openstudio::filesystem::file_size(compressedPath), openstudio::filesystem::file_size(rawPath));
+
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+
+  for (const openstudio::path& p : {compressedPath, rawPath}) {
+    SqlFileColumnarReader reader(p);
+    EXPECT_EQ(sqlFile.energyPlusVersion(), reader.energyPlusVersion());
+    EXPECT_EQ(availableEnvPeriods, reader.availableEnvPeriods());
+    EXPECT_FALSE(reader.variables().empty());
+
+    for (const auto& [name, keyValue] : std::vector<std::pair<std::string, std::string>>{{"Electricity:Facility", ""},
+                                                                                         {"Site Outdoor Air Drybulb Temperature", "Environment"}}) {
+      compareColumnarTimeSeries(sqlFile.timeSeries(availableEnvPeriods[0], "Hourly", name, keyValue),
+                                reader.timeSeries(availableEnvPeriods[0], "Hourly", name, keyValue));
+    }
+    compareColumnarTimeSeries(sqlFile.timeSeries(availableEnvPeriods[0], "Run Period", "Electricity:Facility", ""),
+                              reader.timeSeries(availableEnvPeriods[0], "Run Period", "Electricity:Facility", ""));
+
+    EXPECT_FALSE(reader.timeSeries(availableEnvPeriods[0], "Hourly", "NotAVariable:Facility", ""));
+    EXPECT_THROW(reader.values(reader.variables().size()), std::out_of_range);
+  }
+
+  // every reporting frequency, Daily and Monthly are interval series, RunPeriod and Annual are placed at the end of the year
+  openstudio::path fromPath = resourcesPath() / toPath("utilities/SqlFile/1ZoneEvapCooler-V9-5-0.sql");
+  openstudio::path evapCoolerPath = toPath("./SqlFile_ExportColumnar_1ZoneEvapCooler.sql");
+  if (openstudio::filesystem::exists(evapCoolerPath)) {
+    openstudio::filesystem::remove(evapCoolerPath);
+  }
+  openstudio::filesystem::copy(fromPath, evapCoolerPath);
+  SqlFile evapCoolerSqlFile(evapCoolerPath);
+  ASSERT_TRUE(evapCoolerSqlFile.connectionOpen());
+  openstudio::path evapCoolerColumnarPath = toPath("./SqlFile_ExportColumnar_1ZoneEvapCooler.oscol");
+  ASSERT_TRUE(evapCoolerSqlFile.exportColumnar(evapCoolerColumnarPath));
+  SqlFileColumnarReader evapCoolerReader(evapCoolerColumnarPath);
+  std::vector<std::string> evapCoolerEnvPeriods = evapCoolerSqlFile.availableEnvPeriods();
+  ASSERT_EQ(1u, evapCoolerEnvPeriods.size());
+  for (const std::string& reportingFrequency : {"Hourly", "Daily", "Monthly", "Run Period", "Annual"}) {
+    SCOPED_TRACE(reportingFrequency);
+    boost::optional<TimeSeries> expected =
+      evapCoolerSqlFile.timeSeries(evapCoolerEnvPeriods[0], reportingFrequency, "Zone Mean Air Temperature", "Main Zone");
+    compareColumnarTimeSeries(expected,
+                              evapCoolerReader.timeSeries(evapCoolerEnvPeriods[0], reportingFrequency, "Zone Mean Air Temperature", "Main Zone"));
+    if (expected && ((reportingFrequency == "Daily") || (reportingFrequency == "Hourly"))) {
+      EXPECT_TRUE(expected->intervalLength());
+    }
+  }
+
+  // not a columnar file
+  EXPECT_THROW(SqlFileColumnarReader{sqlFile.path()}, std::runtime_error);
+}